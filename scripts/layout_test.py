@@ -0,0 +1,23 @@
+"""
+    @file
+    @brief send a scene layout to the display over the TCP service
+    @author
+    @details the layout replaces the clock until a message with "layout": null is sent
+   
+"""
+
+import socket
+import json
+
+if __name__ == '__main__':
+    socket = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+    socket.connect(('10.0.0.201', 1234))
+
+    layout = {'background': [0, 0, 16],
+              'elements': [
+                  {'type': 'rectangle', 'x': 0, 'y': 0, 'width': 64, 'height': 32, 'color': [0, 64, 128]},
+                  {'type': 'text', 'text': 'HELLO', 'font': '9x18B', 'x': 0, 'y': 0, 'width': 64, 'height': 32,
+                   'align': 'center', 'valign': 'center', 'color': [255, 128, 128]}
+              ]}
+    message = '{}\n'.format(json.dumps({'layout': layout}))
+    socket.send(message.encode())
@@ -0,0 +1,103 @@
+# -*- coding: utf-8 -*-
+"""
+@brief
+@description
+    pack images into a memory mappable sprite sheet for the led matrix graphics library
+    (see source/graphics/sprites/sprite_sheet.hpp for the file layout).
+
+    Each image becomes one sprite named after its file name. Animated images (GIF/APNG) contribute
+    one frame per image frame, and still images can be split into a horizontal strip of frames with
+    --frame-width. A 1-bit mask is stored for any image with an alpha channel.
+
+    usage: python3 sprite_packer.py output.sprites icons/*.png [--frame-width 16]
+"""
+
+import argparse
+import os
+import struct
+
+from PIL import Image, ImageSequence
+
+
+MAGIC = b'LRPS'
+VERSION = 1
+NAME_LENGTH = 32
+HEADER_FORMAT = '<4sHHII'
+ENTRY_FORMAT = '<32sHHHHII'
+ALPHA_THRESHOLD = 128
+
+
+def align(offset, alignment=4):
+    return (offset + alignment - 1) // alignment * alignment
+
+
+def load_frames(path, frame_width):
+    """ load every frame of an image as an RGBA image """
+    image = Image.open(path)
+    frames = [frame.convert('RGBA') for frame in ImageSequence.Iterator(image)]
+    if frame_width and len(frames) == 1 and frames[0].width > frame_width:
+        strip = frames[0]
+        frames = [strip.crop((x, 0, x + frame_width, strip.height)) for x in range(0, strip.width, frame_width)]
+    has_alpha = image.mode in ('RGBA', 'LA', 'PA') or 'transparency' in image.info
+    return frames, has_alpha
+
+
+def encode_pixels(frame):
+    """ encode a frame as packed 0x00RRGGBB little endian words """
+    return b''.join(struct.pack('<I', (r << 16) | (g << 8) | b) for r, g, b, _ in frame.getdata())
+
+
+def encode_mask(frame):
+    """ encode a frame's alpha as rows of bits, most significant bit first """
+    data = bytearray()
+    pixels = list(frame.getdata())
+    for y in range(frame.height):
+        row = pixels[y * frame.width:(y + 1) * frame.width]
+        for x in range(0, frame.width, 8):
+            byte = 0
+            for bit, pixel in enumerate(row[x:x + 8]):
+                if pixel[3] >= ALPHA_THRESHOLD:
+                    byte |= 0x80 >> bit
+            data.append(byte)
+    return bytes(data)
+
+
+def pack(output, paths, frame_width):
+    sprites = []
+    for path in paths:
+        name = os.path.splitext(os.path.basename(path))[0].encode()
+        if len(name) >= NAME_LENGTH:
+            raise ValueError('sprite name too long: {}'.format(name))
+        frames, has_alpha = load_frames(path, frame_width)
+        pixels = b''.join(encode_pixels(frame) for frame in frames)
+        mask = b''.join(encode_mask(frame) for frame in frames) if has_alpha else b''
+        sprites.append((name, frames[0].width, frames[0].height, len(frames), pixels, mask))
+
+    # the loader binary searches the sprite table by name
+    sprites.sort(key=lambda sprite: sprite[0])
+
+    offset = struct.calcsize(HEADER_FORMAT) + len(sprites) * struct.calcsize(ENTRY_FORMAT)
+    entries = []
+    data = bytearray()
+    for name, width, height, frame_count, pixels, mask in sprites:
+        pixel_offset = align(offset + len(data))
+        data += b'\0' * (pixel_offset - offset - len(data)) + pixels
+        mask_offset = 0
+        if mask:
+            mask_offset = align(offset + len(data))
+            data += b'\0' * (mask_offset - offset - len(data)) + mask
+        entries.append(struct.pack(ENTRY_FORMAT, name, width, height, frame_count, 0, pixel_offset, mask_offset))
+
+    with open(output, 'wb') as sheet:
+        sheet.write(struct.pack(HEADER_FORMAT, MAGIC, VERSION, 0, len(sprites), 0))
+        sheet.write(b''.join(entries))
+        sheet.write(data)
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='pack images into an led matrix sprite sheet')
+    parser.add_argument('output', help='sprite sheet file to write')
+    parser.add_argument('images', nargs='+', help='images to pack')
+    parser.add_argument('--frame-width', type=int, default=0, help='split still images into frames of this width')
+    args = parser.parse_args()
+    pack(args.output, args.images, args.frame_width)
@@ -0,0 +1,92 @@
+# -*- coding: utf-8 -*-
+"""
+@brief
+@description
+    encode an animated image into a streaming video file for the led matrix graphics library
+    (see source/graphics/video/video_reader.hpp for the file layout).
+
+    Frames are resized to the panel and each one is stored with whichever of the raw, run length or
+    delta encodings is smallest. Frame timestamps come from the source image's frame durations.
+
+    usage: python3 video_packer.py output.video clip.gif --width 64 --height 32
+"""
+
+import argparse
+import struct
+
+from PIL import Image, ImageSequence
+
+
+MAGIC = b'LRPV'
+VERSION = 1
+HEADER_FORMAT = '<4sHHHHIII'
+FRAME_HEADER_FORMAT = '<IB3xI'
+RAW, RLE, DELTA = 0, 1, 2
+DEFAULT_FRAME_MS = 100
+
+
+def frame_pixels(frame, width, height):
+    """ resize a frame to the panel and return its packed 0x00RRGGBB pixels """
+    frame = frame.convert('RGB').resize((width, height))
+    return [(r << 16) | (g << 8) | b for r, g, b in frame.getdata()]
+
+
+def encode_raw(pixels):
+    return struct.pack('<{}I'.format(len(pixels)), *pixels)
+
+
+def encode_rle(pixels):
+    words = []
+    run_start = 0
+    for index in range(1, len(pixels) + 1):
+        if index == len(pixels) or pixels[index] != pixels[run_start]:
+            words += [index - run_start, pixels[run_start]]
+            run_start = index
+    return struct.pack('<{}I'.format(len(words)), *words)
+
+
+def encode_delta(pixels, previous):
+    words = []
+    position = 0
+    index = 0
+    while index < len(pixels):
+        if pixels[index] == previous[index]:
+            index += 1
+            continue
+        run_start = index
+        while index < len(pixels) and pixels[index] != previous[index]:
+            index += 1
+        words += [run_start - position, index - run_start] + pixels[run_start:index]
+        position = index
+    return struct.pack('<{}I'.format(len(words)), *words)
+
+
+def pack(output, path, width, height):
+    image = Image.open(path)
+    frames = []
+    timestamp = 0
+    previous = None
+    for frame in ImageSequence.Iterator(image):
+        pixels = frame_pixels(frame, width, height)
+        candidates = [(RAW, encode_raw(pixels)), (RLE, encode_rle(pixels))]
+        # the first frame is never a delta so the player can loop back to it
+        if previous is not None:
+            candidates.append((DELTA, encode_delta(pixels, previous)))
+        encoding, payload = min(candidates, key=lambda candidate: len(candidate[1]))
+        frames.append(struct.pack(FRAME_HEADER_FORMAT, timestamp, encoding, len(payload)) + payload)
+        timestamp += frame.info.get('duration', DEFAULT_FRAME_MS) or DEFAULT_FRAME_MS
+        previous = pixels
+
+    with open(output, 'wb') as video:
+        video.write(struct.pack(HEADER_FORMAT, MAGIC, VERSION, 0, width, height, len(frames), timestamp, 0))
+        video.write(b''.join(frames))
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='encode an animation into an led matrix video file')
+    parser.add_argument('output', help='video file to write')
+    parser.add_argument('input', help='animated image to encode')
+    parser.add_argument('--width', type=int, default=64, help='panel width in pixels')
+    parser.add_argument('--height', type=int, default=32, help='panel height in pixels')
+    args = parser.parse_args()
+    pack(args.output, args.input, args.width, args.height)
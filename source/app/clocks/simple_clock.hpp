@@ -25,12 +25,6 @@ class simple_clock : protected shape {
 
     void draw(canvas& canvas) {
         auto now = std::chrono::system_clock::now();
-        auto delta = std::chrono::duration_cast<std::chrono::seconds>(now - last_draw_time);
-        if ( delta.count() == 0 ) {
-            return;
-        }
-
-        last_draw_time = now;
         canvas.clear();
 
         auto local = std::chrono::system_clock::to_time_t(now);
@@ -46,9 +40,15 @@ class simple_clock : protected shape {
         time_renderer.draw(canvas);
     }
 
+    // Time the displayed value next changes, which is the start of the next minute
+    std::chrono::steady_clock::time_point next_update() const {
+        auto now = std::chrono::system_clock::now();
+        auto next_minute = std::chrono::floor<std::chrono::minutes>(now) + std::chrono::minutes(1);
+        return std::chrono::steady_clock::now() + (next_minute - now);
+    }
+
   private:
     fonts::font font;
-    timestamp last_draw_time;
     graphics::pixel color{255, 128, 128};
 };
 };  // namespace graphics::clocks
\ No newline at end of file
@@ -0,0 +1,68 @@
+// Countdown display for the interval timer
+
+#pragma once
+
+#include "fmt/core.h"
+#include "graphics.hpp"
+#include "interval_timer.hpp"
+#include <chrono>
+#include <cstdint>
+
+namespace intervals
+{
+
+// Countdown of the current phase of a running workout
+class interval_display {
+  public:
+    interval_display(graphics::origin origin, graphics::fonts::font& font)
+        : origin(origin)
+        , font(font) { }
+
+    // Draw the time left in the current phase in the phase's color, with the phase's progress along the bottom row
+    void draw(graphics::canvas& canvas, const interval_timer& timer, time_point now) {
+        canvas.clear();
+        auto current = timer.current();
+        if ( current == nullptr ) {
+            return;
+        }
+
+        color = phase_color(current->kind);
+        auto seconds = timer.remaining_seconds(now);
+        auto time_string = fmt::format("{}:{:02}", seconds / 60, seconds % 60);
+        auto time_characters = font.encode_with_default(time_string, ' ');
+        auto time_renderer = graphics::text_box(time_characters,
+                                                origin,
+                                                color,
+                                                canvas.width(),
+                                                canvas.height(),
+                                                graphics::horizontal_alignment::center,
+                                                graphics::vertical_alignment::center);
+        time_renderer.draw(canvas);
+
+        auto length = current->end - current->start;
+        auto elapsed = length - timer.remaining(now);
+        auto progress = static_cast<int>(canvas.width() * elapsed / length);
+        canvas.fill_span(0, canvas.height() - 1, progress, color);
+    }
+
+  private:
+    static graphics::pixel phase_color(phase_kind kind) {
+        switch ( kind ) {
+            case phase_kind::warmup:
+                return graphics::pixel{255, 160, 0};
+            case phase_kind::high:
+                return graphics::pixel{255, 32, 32};
+            case phase_kind::low:
+                return graphics::pixel{32, 255, 64};
+            case phase_kind::cooldown:
+                return graphics::pixel{64, 128, 255};
+        }
+        return graphics::pixel{255, 255, 255};
+    }
+
+    graphics::origin origin;
+    graphics::fonts::font font;
+    graphics::pixel color{255, 255, 255};
+};
+
+};  // namespace intervals
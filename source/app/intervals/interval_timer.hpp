@@ -0,0 +1,251 @@
+#pragma once
+
+#include "expected.hpp"
+#include "nlohmann/json.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace intervals
+{
+
+using clock = std::chrono::steady_clock;
+using time_point = clock::time_point;
+
+// Part of a workout
+enum class phase_kind { warmup, high, low, cooldown };
+
+// Workout configuration, as sent to the TCP service by scripts/socket_test.py
+struct interval_settings {
+    std::chrono::milliseconds high;      // length of each high intensity interval
+    std::chrono::milliseconds low;       // length of the rest after each high interval
+    std::chrono::milliseconds warmup;    // length of the warmup before the first set, zero for none
+    std::chrono::milliseconds cooldown;  // length of the cooldown after the last set, zero for none
+    int total_intervals;                 // high and low pairs in a set
+    int repeat_times;                    // number of sets
+
+    static constexpr int64_t max_length_ms = 24 * 60 * 60 * 1000;  // longest phase accepted from a message
+    static constexpr int64_t max_intervals = 1000;                  // most high and low pairs in a whole workout
+
+    /**
+     * \brief parse the settings from a JSON message. Lengths and counts are bounded so a malformed message can not make
+     *        the schedule allocate without limit.
+     *
+     * \param config the message
+     * \retval expected<interval_settings, std::string> the settings or a description of what is missing or out of range
+     */
+    static expected<interval_settings, std::string> from_json(const nlohmann::json& config) {
+        using expected_type = expected<interval_settings, std::string>;
+        std::string error;
+        auto read = [&](const char* key, std::optional<int64_t> fallback, int64_t min, int64_t max) -> int64_t {
+            if ( !config.contains(key) && fallback ) {
+                return *fallback;
+            }
+            if ( !config.contains(key) || !config[key].is_number_integer() || (config[key].get<int64_t>() < min) ||
+                 (config[key].get<int64_t>() > max) ) {
+                if ( error.empty() ) {
+                    error = std::string{"interval settings need "} + key + " from " + std::to_string(min) + " to " + std::to_string(max);
+                }
+                return min;
+            }
+            return config[key].get<int64_t>();
+        };
+
+        interval_settings settings;
+        settings.high = std::chrono::milliseconds{read("high_interval_ms", {}, 0, max_length_ms)};
+        settings.low = std::chrono::milliseconds{read("low_interval_ms", {}, 0, max_length_ms)};
+        settings.warmup = std::chrono::milliseconds{read("warmup_interval_ms", 0, 0, max_length_ms)};
+        settings.cooldown = std::chrono::milliseconds{read("cooldown_interval_ms", 0, 0, max_length_ms)};
+        settings.total_intervals = static_cast<int>(read("total_intervals", {}, 0, max_intervals));
+        settings.repeat_times = static_cast<int>(read("repeat_times", 1, 1, max_intervals));
+        if ( error.empty() && (int64_t{settings.total_intervals} * settings.repeat_times > max_intervals) ) {
+            error = "interval settings allow at most " + std::to_string(max_intervals) + " intervals across all repeats";
+        }
+        return error.empty() ? expected_type::success(settings) : expected_type::error(error);
+    }
+};
+
+// One phase of a workout with its absolute start and end
+struct phase {
+    phase_kind kind;
+    int interval;  // interval within the set, counting from 1, or 0 for warmup and cooldown
+    int repeat;    // set, counting from 1, or 0 for warmup and cooldown
+    time_point start;
+    time_point end;
+};
+
+/**
+ * \brief lay out every phase of a workout as absolute deadlines. Each boundary is the start time plus the exact sum of
+ *        the phases before it, so no error builds up however long the workout runs. Empty phases are left out.
+ *
+ * \param settings the workout
+ * \param start when the workout starts
+ * \retval std::vector<phase> the phases in order
+ */
+inline std::vector<phase> build_schedule(const interval_settings& settings, time_point start) {
+    std::vector<phase> schedule;
+    auto elapsed = std::chrono::milliseconds{0};
+    auto add = [&](phase_kind kind, std::chrono::milliseconds length, int interval, int repeat) {
+        if ( length.count() > 0 ) {
+            schedule.push_back(phase{kind, interval, repeat, start + elapsed, start + elapsed + length});
+            elapsed += length;
+        }
+    };
+
+    add(phase_kind::warmup, settings.warmup, 0, 0);
+    for ( int repeat = 1; repeat <= settings.repeat_times; repeat++ ) {
+        for ( int interval = 1; interval <= settings.total_intervals; interval++ ) {
+            add(phase_kind::high, settings.high, interval, repeat);
+            add(phase_kind::low, settings.low, interval, repeat);
+        }
+    }
+    add(phase_kind::cooldown, settings.cooldown, 0, 0);
+    return schedule;
+}
+
+// Histogram of how late phase transitions were handled. Bucket limits double from 250us, and the last bucket holds
+// everything later than that.
+class lateness_histogram {
+  public:
+    static constexpr std::size_t bucket_count = 8;
+
+    // Add a transition
+    void record(clock::duration lateness) {
+        auto us = std::max<int64_t>(std::chrono::duration_cast<std::chrono::microseconds>(lateness).count(), 0);
+        std::size_t index = 0;
+        while ( (index < bucket_count - 1) && (us >= limit_us(index)) ) {
+            index++;
+        }
+        buckets[index]++;
+        total++;
+        worst = std::max(worst, std::chrono::microseconds{us});
+    }
+
+    // Get the exclusive upper limit of a bucket in microseconds. The last bucket has no limit.
+    static constexpr int64_t limit_us(std::size_t index) {
+        return int64_t{250} << index;
+    }
+
+    // Get the number of transitions in a bucket
+    uint64_t bucket(std::size_t index) const {
+        return buckets[index];
+    }
+
+    // Get the number of transitions recorded
+    uint64_t count() const {
+        return total;
+    }
+
+    // Get the latest transition
+    std::chrono::microseconds max() const {
+        return worst;
+    }
+
+    // Clear the histogram
+    void reset() {
+        buckets.fill(0);
+        total = 0;
+        worst = std::chrono::microseconds{0};
+    }
+
+  private:
+    std::array<uint64_t, bucket_count> buckets{};
+    uint64_t total = 0;
+    std::chrono::microseconds worst{0};
+};
+
+// Runs a workout from its precomputed schedule. The timer never sleeps: its owner asks for the next deadline, wakes
+// then and calls update. Every deadline comes from the schedule, so a late wakeup delays only that one redraw and
+// never shifts the phases after it. Not thread safe.
+class interval_timer {
+  public:
+    /**
+     * \brief start a workout
+     *
+     * \param settings the workout
+     * \param now start time of the first phase
+     */
+    void start(const interval_settings& settings, time_point now) {
+        phases = build_schedule(settings, now);
+        index = 0;
+        transitions.reset();
+    }
+
+    // Stop the workout
+    void stop() {
+        index = phases.size();
+    }
+
+    // Check if a workout is in progress
+    bool is_running() const {
+        return index < phases.size();
+    }
+
+    /**
+     * \brief move to the phase that contains a time, recording how late each transition passed was handled
+     *
+     * \param now the current time
+     * \retval bool true if the phase changed
+     */
+    bool update(time_point now) {
+        auto changed = false;
+        while ( (index < phases.size()) && (now >= phases[index].end) ) {
+            transitions.record(now - phases[index].end);
+            index++;
+            changed = true;
+        }
+        return changed;
+    }
+
+    // Get the current phase, nullptr when no workout is running
+    const phase* current() const {
+        return is_running() ? &phases[index] : nullptr;
+    }
+
+    // Get the time left in the current phase
+    clock::duration remaining(time_point now) const {
+        return is_running() ? std::max(phases[index].end - now, clock::duration::zero()) : clock::duration::zero();
+    }
+
+    // Get the whole seconds left in the current phase, rounded up the way a countdown shows them
+    int remaining_seconds(time_point now) const {
+        auto left = remaining(now);
+        return static_cast<int>((left + std::chrono::seconds(1) - clock::duration(1)) / std::chrono::seconds(1));
+    }
+
+    /**
+     * \brief get when the display next changes: the next whole second of the countdown or the end of the phase
+     *
+     * \param now the current time
+     * \retval std::optional<time_point> the deadline, or nothing once the workout is over
+     */
+    std::optional<time_point> next_deadline(time_point now) const {
+        if ( !is_running() ) {
+            return {};
+        }
+        auto seconds = remaining_seconds(now);
+        return phases[index].end - std::chrono::seconds(std::max(seconds - 1, 0));
+    }
+
+    // Get the lateness of every phase transition so far
+    const lateness_histogram& lateness() const {
+        return transitions;
+    }
+
+    // Get the schedule of the workout
+    const std::vector<phase>& schedule() const {
+        return phases;
+    }
+
+  private:
+    std::vector<phase> phases;
+    std::size_t index = 0;
+    lateness_histogram transitions;
+};
+
+};  // namespace intervals
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "content_arbiter.hpp"
+#include "graphics.hpp"
+#include <chrono>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace tasks
+{
+
+// Message shown for a fixed time. Only time on screen counts towards the duration, so an alert preempted by a more
+// urgent one is shown for its full time once it resumes.
+class alert_task : public content_task {
+  public:
+    alert_task(const std::string& message, graphics::fonts::font& font, graphics::pixel color, std::chrono::milliseconds duration)
+        : characters(font.encode_with_default(message, ' '))
+        , color(color)
+        , duration(duration)
+        , shown(0) { }
+
+    std::optional<time_point> draw(graphics::canvas& canvas, time_point now) override {
+        if ( !since ) {
+            since = now;
+        }
+        auto elapsed = shown + (now - *since);
+        if ( elapsed >= duration ) {
+            return {};
+        }
+
+        canvas.clear();
+        auto renderer = graphics::text_box(characters,
+                                           graphics::origin{0, 0},
+                                           color,
+                                           canvas.width(),
+                                           canvas.height(),
+                                           graphics::horizontal_alignment::center,
+                                           graphics::vertical_alignment::center);
+        renderer.draw(canvas);
+        return now + (duration - elapsed);
+    }
+
+    void on_preempted(time_point now) override {
+        if ( since ) {
+            shown += now - *since;
+            since.reset();
+        }
+    }
+
+  private:
+    std::vector<graphics::fonts::character> characters;
+    graphics::pixel color;
+    clock::duration duration;
+    clock::duration shown;
+    std::optional<time_point> since;  // start of the current stretch on screen
+};
+
+};  // namespace tasks
@@ -0,0 +1,251 @@
+#pragma once
+
+#include "graphics.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace tasks
+{
+
+// Content that takes over the display while it is the highest priority task. A task is an object rather than a
+// thread: when a more urgent task arrives it is simply not drawn until that one finishes, and it keeps every bit of
+// its state in the meantime.
+class content_task {
+  public:
+    using clock = std::chrono::steady_clock;
+    using time_point = clock::time_point;
+
+    virtual ~content_task() = default;
+
+    // Draw a frame of the task. Returns when it next needs to be drawn, or nothing once it has finished.
+    virtual std::optional<time_point> draw(graphics::canvas& canvas, time_point now) = 0;
+
+    // Called at the frame boundary where a more urgent task takes the display
+    virtual void on_preempted(time_point now) {
+        (void)now;
+    }
+
+    // Called at the frame boundary where the task gets the display back
+    virtual void on_resumed(time_point now) {
+        (void)now;
+    }
+};
+
+// Chooses which content task owns the display. Tasks are submitted from any thread with a priority and the render
+// loop picks the most urgent one at its next frame boundary, so an alert preempts background content within one frame
+// of its deadline being pulled in by the wake handler. Tasks of equal priority run in submission order. The time from
+// submission to the first frame of a task being presented is measured for every task.
+class content_arbiter {
+  public:
+    using clock = content_task::clock;
+    using time_point = content_task::time_point;
+
+    // Identifier of a submitted task
+    using task_id = uint64_t;
+
+    // Arbiter counters
+    struct statistics {
+        uint64_t submitted;                      // tasks submitted
+        uint64_t completed;                      // tasks that finished or were removed
+        uint64_t preemptions;                    // times a running task gave the display to a more urgent one
+        uint64_t resumptions;                    // times a preempted task got the display back
+        uint64_t over_budget;                    // tasks presented later than the latency budget
+        uint64_t latency_count;                  // tasks whose latency was measured
+        std::chrono::microseconds max_latency;   // longest submission to presentation time
+        std::chrono::microseconds total_latency; // sum of the measured latencies
+    };
+
+    /**
+     * \brief Construct a new content arbiter
+     *
+     * \param latency_budget longest acceptable time from submitting a task to its first frame being presented
+     */
+    explicit content_arbiter(std::chrono::microseconds latency_budget = std::chrono::milliseconds(20))
+        : latency_budget(latency_budget)
+        , next_id(1)
+        , next_sequence(0)
+        , active(0)
+        , counters{0, 0, 0, 0, 0, 0, std::chrono::microseconds{0}, std::chrono::microseconds{0}} { }
+
+    // Set the function called after a submission to bring the render loop to its next frame boundary
+    void set_wake_handler(std::function<void()> handler) {
+        std::lock_guard<std::mutex> lock{mutex};
+        wake = std::move(handler);
+    }
+
+    /**
+     * \brief submit a task. Safe to call from any thread.
+     *
+     * \param task the task
+     * \param priority higher values preempt lower ones
+     * \param submitted time the request arrived, the start of its latency measurement
+     * \retval task_id identifier of the task
+     */
+    task_id submit(std::shared_ptr<content_task> task, int priority, time_point submitted = clock::now()) {
+        std::function<void()> handler;
+        task_id id;
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            id = next_id++;
+            incoming.push_back(entry{id, priority, next_sequence++, std::move(task), submitted, false, false, false});
+            handler = wake;
+        }
+        if ( handler ) {
+            handler();
+        }
+        return id;
+    }
+
+    // Remove a task at the next frame boundary. Safe to call from any thread.
+    void remove(task_id id) {
+        std::lock_guard<std::mutex> lock{mutex};
+        removed.push_back(id);
+    }
+
+    /**
+     * \brief draw the most urgent task. Call on the render loop once per frame. A task that finishes hands the display
+     *        on within the same frame.
+     *
+     * \param canvas the canvas to draw on
+     * \param now the frame time
+     * \retval true if a task drew the frame, false if there are no tasks
+     */
+    bool draw(graphics::canvas& canvas, time_point now) {
+        take_incoming();
+        while ( !entries.empty() ) {
+            auto& top = entries.front();
+            if ( (active != top.id) && (active != 0) ) {
+                auto previous = find(active);
+                if ( previous != entries.end() ) {
+                    previous->task->on_preempted(now);
+                    previous->preempted = true;
+                    counters.preemptions++;
+                }
+            }
+            if ( active != top.id ) {
+                if ( top.preempted ) {
+                    top.task->on_resumed(now);
+                    top.preempted = false;
+                    counters.resumptions++;
+                }
+                active = top.id;
+            }
+
+            deadline = top.task->draw(canvas, now);
+            if ( deadline ) {
+                if ( !top.drawn ) {
+                    top.drawn = true;
+                    top.awaiting_present = true;
+                }
+                return true;
+            }
+            entries.erase(entries.begin());
+            active = 0;
+            counters.completed++;
+        }
+        deadline.reset();
+        return false;
+    }
+
+    /**
+     * \brief record that the frame drawn last has reached the panel. Call after presenting to complete the latency
+     *        measurement of newly shown tasks.
+     *
+     * \param now the time the frame was presented
+     */
+    void presented(time_point now) {
+        for ( auto& item : entries ) {
+            if ( item.awaiting_present ) {
+                item.awaiting_present = false;
+                auto latency = std::chrono::duration_cast<std::chrono::microseconds>(now - item.submitted);
+                counters.latency_count++;
+                counters.total_latency += latency;
+                counters.max_latency = std::max(counters.max_latency, latency);
+                counters.over_budget += (latency > latency_budget) ? 1 : 0;
+            }
+        }
+    }
+
+    // Get when the task drawn last needs its next frame, nothing if no task is running
+    std::optional<time_point> next_deadline() const {
+        return deadline;
+    }
+
+    // Check if a task owns the display
+    bool is_active() const {
+        return active != 0;
+    }
+
+    // Get the arbiter counters. Call on the render loop.
+    statistics stats() const {
+        return counters;
+    }
+
+  private:
+    struct entry {
+        task_id id;
+        int priority;
+        uint64_t sequence;
+        std::shared_ptr<content_task> task;
+        time_point submitted;
+        bool drawn;             // has drawn at least one frame
+        bool awaiting_present;  // first frame drawn but not yet presented
+        bool preempted;
+    };
+
+    std::vector<entry>::iterator find(task_id id) {
+        return std::find_if(entries.begin(), entries.end(), [id](const auto& item) { return item.id == id; });
+    }
+
+    // Move submissions and removals made since the last frame into the render loop's list
+    void take_incoming() {
+        std::vector<entry> added;
+        std::vector<task_id> dropped;
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            added.swap(incoming);
+            dropped.swap(removed);
+        }
+        if ( added.empty() && dropped.empty() ) {
+            return;
+        }
+
+        counters.submitted += added.size();
+        for ( auto& item : added ) {
+            entries.push_back(std::move(item));
+        }
+        for ( auto id : dropped ) {
+            auto it = find(id);
+            if ( it != entries.end() ) {
+                entries.erase(it);
+                counters.completed++;
+                active = (active == id) ? 0 : active;
+            }
+        }
+        std::stable_sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) {
+            return (a.priority != b.priority) ? (a.priority > b.priority) : (a.sequence < b.sequence);
+        });
+    }
+
+    std::chrono::microseconds latency_budget;
+    std::function<void()> wake;
+    task_id next_id;
+    uint64_t next_sequence;
+    std::vector<entry> incoming;
+    std::vector<task_id> removed;
+    std::mutex mutex;
+
+    // owned by the render loop
+    std::vector<entry> entries;
+    task_id active;
+    std::optional<time_point> deadline;
+    statistics counters;
+};
+
+};  // namespace tasks
@@ -0,0 +1,193 @@
+#pragma once
+
+#include "timer_wheel.hpp"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace tasks
+{
+
+// Single render loop driven by deadlines. Widgets register a redraw function with the absolute time it next needs to
+// run, and the loop sleeps until the earliest deadline on its timer wheel. Each wakeup runs every redraw that is due,
+// then builds and presents one frame. Nothing wakes up between deadlines, so an idle display costs no CPU.
+class frame_scheduler {
+  public:
+    using clock = std::chrono::steady_clock;
+    using time_point = clock::time_point;
+
+    // Redraw a widget. Runs on the loop thread when its deadline passes and returns when it next needs to run, or
+    // nothing to unregister.
+    using redraw_function = std::function<std::optional<time_point>(time_point now)>;
+
+    // Compose and present a frame after a batch of redraws
+    using frame_function = std::function<void()>;
+
+    // Loop counters
+    struct statistics {
+        uint64_t wakeups;                       // times the loop woke with work to do
+        uint64_t redraws;                       // redraw functions run
+        uint64_t frames;                        // frames presented
+        std::chrono::microseconds max_lateness; // longest delay between a deadline and its redraw starting
+    };
+
+    /**
+     * \brief Construct a new frame scheduler
+     *
+     * \param on_frame function to compose and present a frame after redraws
+     * \param resolution tick of the timer wheel
+     */
+    explicit frame_scheduler(frame_function on_frame, clock::duration resolution = std::chrono::milliseconds(1))
+        : on_frame(std::move(on_frame))
+        , wheel(clock::now(), resolution, 1024)
+        , next_id(1)
+        , running(true)
+        , counters{0, 0, 0, std::chrono::microseconds{0}} { }
+
+    /**
+     * \brief register a redraw function. Safe to call from any thread.
+     *
+     * \param redraw the redraw function
+     * \param first_deadline when it first runs
+     * \retval uint64_t identifier of the registration
+     */
+    uint64_t add(redraw_function redraw, time_point first_deadline = clock::now()) {
+        std::lock_guard<std::mutex> lock{mutex};
+        auto id = next_id++;
+        entries[id] = entry{std::move(redraw), first_deadline, true};
+        wheel.schedule(id, first_deadline);
+        wake.notify_one();
+        return id;
+    }
+
+    /**
+     * \brief move the deadline of a registration, for example when an event needs a redraw sooner. Safe to call from
+     *        any thread.
+     *
+     * \param id the registration
+     * \param deadline the new deadline
+     */
+    void reschedule(uint64_t id, time_point deadline) {
+        std::lock_guard<std::mutex> lock{mutex};
+        auto it = entries.find(id);
+        if ( it == entries.end() ) {
+            return;
+        }
+        if ( it->second.scheduled ) {
+            wheel.cancel(id, it->second.deadline);
+        }
+        it->second.deadline = deadline;
+        it->second.scheduled = true;
+        wheel.schedule(id, deadline);
+        wake.notify_one();
+    }
+
+    // Unregister a redraw function. Safe to call from any thread.
+    void remove(uint64_t id) {
+        std::lock_guard<std::mutex> lock{mutex};
+        auto it = entries.find(id);
+        if ( it != entries.end() ) {
+            if ( it->second.scheduled ) {
+                wheel.cancel(id, it->second.deadline);
+            }
+            entries.erase(it);
+        }
+    }
+
+    /**
+     * \brief run the loop on the calling thread until stop is called
+     */
+    void run() {
+        std::unique_lock<std::mutex> lock{mutex};
+        while ( running ) {
+            auto deadline = wheel.next_deadline();
+            if ( !deadline ) {
+                wake.wait(lock);
+                continue;
+            }
+            if ( clock::now() < *deadline ) {
+                wake.wait_until(lock, *deadline);
+                continue;
+            }
+
+            // collect everything due, then redraw without holding the lock so widgets can reschedule themselves
+            auto now = clock::now();
+            std::vector<std::pair<uint64_t, entry>> due;
+            wheel.expire(now, [&](uint64_t id) {
+                entries[id].scheduled = false;
+                due.emplace_back(id, entries[id]);
+            });
+            counters.wakeups++;
+
+            lock.unlock();
+            std::vector<std::pair<uint64_t, std::optional<time_point>>> next;
+            auto max_lateness = std::chrono::microseconds{0};
+            for ( auto& [id, item] : due ) {
+                max_lateness = std::max(max_lateness, std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - item.deadline));
+                next.emplace_back(id, item.redraw(now));
+            }
+            if ( !due.empty() ) {
+                on_frame();
+            }
+            lock.lock();
+
+            counters.max_lateness = std::max(counters.max_lateness, max_lateness);
+            counters.redraws += due.size();
+            counters.frames += due.empty() ? 0 : 1;
+            for ( auto& [id, deadline] : next ) {
+                auto it = entries.find(id);
+                if ( it == entries.end() ) {
+                    continue;
+                }
+                // a reschedule during the redraw already put the entry back on the wheel
+                if ( it->second.scheduled ) {
+                    continue;
+                }
+                if ( deadline ) {
+                    it->second.deadline = *deadline;
+                    it->second.scheduled = true;
+                    wheel.schedule(id, *deadline);
+                } else {
+                    entries.erase(it);
+                }
+            }
+        }
+    }
+
+    // Stop the loop. Safe to call from any thread, including from a redraw function. A stopped scheduler can't be restarted.
+    void stop() {
+        std::lock_guard<std::mutex> lock{mutex};
+        running = false;
+        wake.notify_one();
+    }
+
+    // Get the loop counters
+    statistics stats() {
+        std::lock_guard<std::mutex> lock{mutex};
+        return counters;
+    }
+
+  private:
+    struct entry {
+        redraw_function redraw;
+        time_point deadline;
+        bool scheduled;  // on the wheel, false while its redraw is running
+    };
+
+    frame_function on_frame;
+    timer_wheel wheel;
+    std::map<uint64_t, entry> entries;
+    uint64_t next_id;
+    bool running;
+    statistics counters;
+    std::mutex mutex;
+    std::condition_variable wake;
+};
+
+};  // namespace tasks
@@ -0,0 +1,186 @@
+#pragma once
+
+#include "config_parser.hpp"
+#include "fmt/core.h"
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <optional>
+#include <string>
+
+namespace tasks
+{
+
+// A running thread that scheduling policies can be applied to from any thread
+struct thread_handle {
+    pthread_t thread;
+    pid_t tid;  // kernel thread id, needed for the per-thread nice value
+};
+
+// Get the handle of the calling thread
+inline thread_handle current_thread() {
+    return thread_handle{pthread_self(), static_cast<pid_t>(syscall(SYS_gettid))};
+}
+
+/**
+ * \brief bind a thread to its cores and set its scheduling policy and priority or nice value. Every part is attempted
+ *        even if an earlier one fails. Real-time priorities and negative nice values need root, so apply them before
+ *        the matrix drops privileges or run with drop_privileges off.
+ *
+ * \param handle the thread
+ * \param policy the policy to apply
+ * \retval std::string the parts that failed and why, empty on success
+ */
+inline std::string apply_thread_policy(const thread_handle& handle, const graphics::thread_policy& policy) {
+    std::string errors;
+    auto fail = [&errors](const char* what, int error) {
+        errors += fmt::format("{}{}: {}", errors.empty() ? "" : ", ", what, std::strerror(error));
+    };
+
+    if ( !policy.cores.empty() ) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for ( auto core : policy.cores ) {
+            if ( (core >= 0) && (core < CPU_SETSIZE) ) {
+                CPU_SET(core, &set);
+            }
+        }
+        if ( auto error = pthread_setaffinity_np(handle.thread, sizeof(set), &set); error != 0 ) {
+            fail("affinity", error);
+        }
+    }
+
+    sched_param param{};
+    param.sched_priority = (policy.policy == graphics::scheduling_policy::fifo) ? policy.priority : 0;
+    auto native = (policy.policy == graphics::scheduling_policy::fifo) ? SCHED_FIFO : SCHED_OTHER;
+    if ( auto error = pthread_setschedparam(handle.thread, native, &param); error != 0 ) {
+        fail("policy", error);
+    }
+    if ( (policy.policy == graphics::scheduling_policy::other) && (setpriority(PRIO_PROCESS, static_cast<id_t>(handle.tid), policy.nice) != 0) ) {
+        fail("nice", errno);
+    }
+    return errors;
+}
+
+/**
+ * \brief check if a policy can only be applied with root, which the matrix drops once it starts unless
+ *        drop_privileges is off
+ *
+ * \param policy the policy
+ * \retval true if the policy uses the fifo policy or a negative nice value
+ */
+inline bool needs_privileges(const graphics::thread_policy& policy) {
+    return (policy.policy == graphics::scheduling_policy::fifo) || (policy.nice < 0);
+}
+
+/**
+ * \brief describe the settings a thread actually runs with, read back from the kernel
+ *
+ * \param handle the thread
+ * \retval std::string cores, policy and priority or nice value
+ */
+inline std::string describe_thread(const thread_handle& handle) {
+    std::string cores;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if ( pthread_getaffinity_np(handle.thread, sizeof(set), &set) == 0 ) {
+        for ( int core = 0; core < CPU_SETSIZE; core++ ) {
+            if ( CPU_ISSET(core, &set) ) {
+                cores += fmt::format("{}{}", cores.empty() ? "" : ",", core);
+            }
+        }
+    }
+
+    int native = SCHED_OTHER;
+    sched_param param{};
+    pthread_getschedparam(handle.thread, &native, &param);
+    if ( native == SCHED_FIFO ) {
+        return fmt::format("cores {} SCHED_FIFO priority {}", cores, param.sched_priority);
+    }
+    errno = 0;
+    auto nice = getpriority(PRIO_PROCESS, static_cast<id_t>(handle.tid));
+    return fmt::format("cores {} SCHED_OTHER nice {}", cores, (errno == 0) ? nice : 0);
+}
+
+// Measures how far swaps of the panel's buffers land from the refresh period. A swap waits for the next refresh, so the
+// time between swaps should be a whole number of refresh periods; any distance from that is jitter caused by the
+// refresh thread or the swapping thread being held off their cores. Reset it when thread settings change to compare
+// settings against each other.
+class refresh_jitter {
+  public:
+    using clock = std::chrono::steady_clock;
+
+    // Jitter counters
+    struct statistics {
+        uint64_t samples;
+        std::chrono::microseconds mean;
+        std::chrono::microseconds max;
+        uint64_t late;  // swaps more than a quarter of a period from a refresh
+    };
+
+    /**
+     * \brief Construct a new refresh jitter meter
+     *
+     * \param refresh_hz the panel refresh rate. Zero estimates the period from the shortest time between swaps.
+     */
+    explicit refresh_jitter(int refresh_hz)
+        : period(std::chrono::microseconds((refresh_hz > 0) ? 1000000 / refresh_hz : 0))
+        , fixed(refresh_hz > 0) {
+        reset();
+    }
+
+    // Record the time a swap returned
+    void record(clock::time_point swapped) {
+        if ( last ) {
+            auto interval = std::chrono::duration_cast<std::chrono::microseconds>(swapped - *last);
+            if ( !fixed && ((period.count() == 0) || (interval < period)) ) {
+                period = interval;
+            }
+            if ( period.count() > 0 ) {
+                auto periods = std::max<int64_t>((interval.count() + period.count() / 2) / period.count(), 1);
+                auto jitter = std::chrono::microseconds(std::abs(interval.count() - periods * period.count()));
+                counters.samples++;
+                total += jitter;
+                counters.max = std::max(counters.max, jitter);
+                counters.late += (jitter * 4 > period) ? 1 : 0;
+            }
+        }
+        last = swapped;
+    }
+
+    // Clear the counters
+    void reset() {
+        counters = statistics{0, std::chrono::microseconds{0}, std::chrono::microseconds{0}, 0};
+        total = std::chrono::microseconds{0};
+        last.reset();
+    }
+
+    // Get the jitter counters
+    statistics stats() const {
+        auto result = counters;
+        result.mean = (counters.samples > 0) ? total / static_cast<int64_t>(counters.samples) : std::chrono::microseconds{0};
+        return result;
+    }
+
+    // Get the refresh period swaps are measured against
+    std::chrono::microseconds refresh_period() const {
+        return period;
+    }
+
+  private:
+    std::chrono::microseconds period;
+    bool fixed;
+    std::optional<clock::time_point> last;
+    std::chrono::microseconds total;
+    statistics counters;
+};
+
+};  // namespace tasks
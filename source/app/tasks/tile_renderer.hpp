@@ -0,0 +1,105 @@
+#pragma once
+
+#include "graphics.hpp"
+#include "work_stealing_pool.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace tasks
+{
+
+// Draws one frame buffer in parallel tiles. Each tile gets its own canvas clipped to it over the shared frame buffer,
+// so tiles never write the same pixel and need no locking. Full width row bands are the default tile shape: every
+// band then owns whole cache lines and workers do not contend on the rows at band edges.
+class tile_renderer {
+  public:
+    // Draw the part of the frame that falls inside the canvas clip
+    using tile_function = std::function<void(graphics::canvas& canvas)>;
+
+    /**
+     * \brief Construct a new tile renderer
+     *
+     * \param pool the pool the tiles are drawn on
+     * \param tile_width tile width in pixels, zero for the full frame width
+     * \param tile_height tile height in pixels
+     */
+    tile_renderer(work_stealing_pool& pool, uint16_t tile_width = 0, uint16_t tile_height = 8)
+        : pool(pool)
+        , tile_width(tile_width)
+        , tile_height(std::max<uint16_t>(tile_height, 1)) { }
+
+    /**
+     * \brief draw every tile of a frame and wait for all of them. The function runs concurrently for different tiles.
+     *
+     * \param frame the shared frame buffer
+     * \param draw function drawing the part of the frame inside one tile
+     */
+    void render(graphics::framebuffer& frame, const tile_function& draw) {
+        auto tiles = split(frame);
+        pool.parallel_for(tiles.size(), [&](size_t index) {
+            graphics::canvas canvas{&frame, tiles[index]};
+            draw(canvas);
+        });
+    }
+
+    /**
+     * \brief draw every tile of a canvas and wait for all of them. Each tile gets a copy of the canvas clipped to it, so
+     *        the function draws in the canvas' own coordinates and runs concurrently for different tiles.
+     *
+     * \param canvas the shared canvas, for example a region's
+     * \param draw function drawing the part of the canvas inside one tile
+     */
+    void render(graphics::canvas& canvas, const tile_function& draw) {
+        auto tiles = split(canvas.width(), canvas.height());
+        pool.parallel_for(tiles.size(), [&](size_t index) {
+            auto tile = canvas.clipped(tiles[index]);
+            draw(tile);
+        });
+    }
+
+    /**
+     * \brief draw a list of shapes, in order, into every tile. Shapes must draw without changing their own state, which
+     *        holds for span shapes, sprites and text. Effects and charts keep per-frame state and should be rendered
+     *        once before being drawn here.
+     *
+     * \param frame the shared frame buffer
+     * \param shapes the shapes to draw, back to front
+     */
+    void render(graphics::framebuffer& frame, const std::vector<std::shared_ptr<graphics::shape>>& shapes) {
+        render(frame, [&shapes](graphics::canvas& canvas) {
+            for ( auto& item : shapes ) {
+                item->draw(canvas);
+            }
+        });
+    }
+
+    // Split a frame into tiles, row by row
+    std::vector<graphics::rect> split(const graphics::framebuffer& frame) const {
+        return split(frame.width(), frame.height());
+    }
+
+    // Split an area of the given size into tiles, row by row
+    std::vector<graphics::rect> split(int frame_width, int frame_height) const {
+        auto width = (tile_width == 0) ? frame_width : std::min<int>(tile_width, frame_width);
+        std::vector<graphics::rect> tiles;
+        for ( int y = 0; y < frame_height; y += tile_height ) {
+            for ( int x = 0; x < frame_width; x += width ) {
+                tiles.push_back(graphics::rect{static_cast<int16_t>(x),
+                                               static_cast<int16_t>(y),
+                                               static_cast<uint16_t>(std::min(width, frame_width - x)),
+                                               static_cast<uint16_t>(std::min<int>(tile_height, frame_height - y))});
+            }
+        }
+        return tiles;
+    }
+
+  private:
+    work_stealing_pool& pool;
+    uint16_t tile_width;
+    uint16_t tile_height;
+};
+
+};  // namespace tasks
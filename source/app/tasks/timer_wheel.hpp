@@ -0,0 +1,147 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace tasks
+{
+
+// Hashed timer wheel of absolute steady_clock deadlines. Time is split into fixed ticks and each timer lives in the
+// slot of its deadline's tick modulo the wheel size, so scheduling, cancelling and expiring are all proportional to
+// the timers in a slot rather than to every timer. Timers further out than one revolution share slots with nearer
+// ones and are skipped until their deadline comes around.
+class timer_wheel {
+  public:
+    using clock = std::chrono::steady_clock;
+    using time_point = clock::time_point;
+
+    /**
+     * \brief Construct a new timer wheel
+     *
+     * \param start time of the first tick
+     * \param tick resolution of the wheel
+     * \param slots number of ticks in one revolution
+     */
+    timer_wheel(time_point start, clock::duration tick, std::size_t slots)
+        : start(start)
+        , tick(tick)
+        , wheel(slots)
+        , current_tick(0)
+        , timer_count(0) { }
+
+    /**
+     * \brief add a timer. Deadlines in the past expire on the next call to expire.
+     *
+     * \param id identifier passed back when the timer expires
+     * \param deadline time the timer expires
+     */
+    void schedule(uint64_t id, time_point deadline) {
+        wheel[tick_of(deadline) % wheel.size()].push_back(timer{id, deadline});
+        timer_count++;
+    }
+
+    /**
+     * \brief remove a timer
+     *
+     * \param id identifier of the timer
+     * \param deadline deadline the timer was scheduled with
+     * \retval true if the timer was found
+     */
+    bool cancel(uint64_t id, time_point deadline) {
+        auto& slot = wheel[tick_of(deadline) % wheel.size()];
+        auto it = std::find_if(slot.begin(), slot.end(), [id](const timer& t) { return t.id == id; });
+        if ( it == slot.end() ) {
+            return false;
+        }
+        slot.erase(it);
+        timer_count--;
+        return true;
+    }
+
+    /**
+     * \brief get the earliest deadline on the wheel
+     *
+     * \retval std::optional<time_point> the deadline, or nothing if the wheel is empty
+     */
+    std::optional<time_point> next_deadline() const {
+        if ( timer_count == 0 ) {
+            return {};
+        }
+
+        // the first slot holding a timer for this revolution has the earliest deadline
+        for ( std::size_t i = 0; i < wheel.size(); i++ ) {
+            auto slot_tick = current_tick + i;
+            std::optional<time_point> earliest;
+            for ( const auto& t : wheel[slot_tick % wheel.size()] ) {
+                if ( (tick_of(t.deadline) <= slot_tick) && (!earliest || (t.deadline < *earliest)) ) {
+                    earliest = t.deadline;
+                }
+            }
+            if ( earliest ) {
+                return earliest;
+            }
+        }
+
+        // every timer is more than a revolution away
+        std::optional<time_point> earliest;
+        for ( const auto& slot : wheel ) {
+            for ( const auto& t : slot ) {
+                earliest = earliest ? std::min(*earliest, t.deadline) : t.deadline;
+            }
+        }
+        return earliest;
+    }
+
+    /**
+     * \brief remove every timer that is due and pass its id to a function, earliest first within each tick
+     *
+     * \param now the current time
+     * \param on_expired function taking the uint64_t id of each expired timer
+     */
+    template <typename Function>
+    void expire(time_point now, Function&& on_expired) {
+        auto now_tick = tick_of(now);
+        auto ticks = std::min<uint64_t>(now_tick - current_tick + 1, wheel.size());
+        for ( uint64_t i = 0; i < ticks; i++ ) {
+            auto& slot = wheel[(current_tick + i) % wheel.size()];
+            std::sort(slot.begin(), slot.end(), [](const timer& a, const timer& b) { return a.deadline < b.deadline; });
+            auto due = std::stable_partition(slot.begin(), slot.end(), [now](const timer& t) { return t.deadline <= now; });
+            std::vector<timer> expired(slot.begin(), due);
+            slot.erase(slot.begin(), due);
+            timer_count -= expired.size();
+            for ( const auto& t : expired ) {
+                on_expired(t.id);
+            }
+        }
+        current_tick = now_tick;
+    }
+
+    // Get the number of timers on the wheel
+    std::size_t size() const {
+        return timer_count;
+    }
+
+  private:
+    struct timer {
+        uint64_t id;
+        time_point deadline;
+    };
+
+    // Tick a deadline falls in. Deadlines before the current tick fall in the current tick.
+    uint64_t tick_of(time_point deadline) const {
+        auto ticks = (deadline > start) ? static_cast<uint64_t>((deadline - start) / tick) : 0;
+        return std::max(ticks, current_tick);
+    }
+
+    time_point start;
+    clock::duration tick;
+    std::vector<std::vector<timer>> wheel;
+    uint64_t current_tick;
+    std::size_t timer_count;
+};
+
+};  // namespace tasks
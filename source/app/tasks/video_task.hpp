@@ -0,0 +1,60 @@
+#pragma once
+
+#include "content_arbiter.hpp"
+#include "graphics.hpp"
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <optional>
+#include <utility>
+
+namespace tasks
+{
+
+// Video clip shown as arbitrated content. Each draw copies the frame due at the draw time and asks to be drawn again
+// at the next frame's timestamp, so playback is paced by the render loop's deadlines rather than a polling thread.
+// The clip keeps to its own timeline while preempted, so frames due during an alert are dropped rather than delayed.
+class video_task : public content_task {
+  public:
+    // How long to wait before looking again when the decoder has not caught up
+    static constexpr std::chrono::milliseconds decode_poll{5};
+
+    /**
+     * \brief Construct a new video task and start decoding
+     *
+     * \param reader the opened clip, the size of the canvas it is drawn on
+     * \param on_decode_start run first on the decode thread, for example to apply its thread settings
+     */
+    explicit video_task(graphics::video_reader&& reader, std::function<void()> on_decode_start = nullptr)
+        : frame(reader.width(), reader.height())
+        , player(std::move(reader)) {
+        player.set_thread_start_handler(std::move(on_decode_start));
+        player.start();
+    }
+
+    std::optional<time_point> draw(graphics::canvas& canvas, time_point now) override {
+        auto error = player.error();
+        if ( !error.empty() ) {
+            std::cerr << error << std::endl;
+            return {};
+        }
+
+        // the canvas is redrawn even without a new frame, as a task that preempted the clip may have drawn over it
+        player.update(frame, now);
+        for ( int y = 0; y < frame.height(); y++ ) {
+            canvas.blit_row(0, y, frame.row(y), frame.width());
+        }
+        return player.next_deadline().value_or(now + decode_poll);
+    }
+
+    // Get the playback counters
+    graphics::video_statistics statistics() const {
+        return player.statistics();
+    }
+
+  private:
+    graphics::framebuffer frame;
+    graphics::video_player player;
+};
+
+};  // namespace tasks
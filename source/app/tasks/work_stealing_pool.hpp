@@ -0,0 +1,242 @@
+#pragma once
+
+#include <pthread.h>
+#include <sched.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace tasks
+{
+
+// Pool of worker threads for splitting one frame's rendering across cores. Every worker owns a queue: it takes work
+// from the back of its own queue and, once that is empty, steals from the front of the others so an uneven batch still
+// keeps every core busy. The thread calling parallel_for helps with the batch and only returns once all of it is done,
+// which is the join point before a frame is swapped or presented.
+class work_stealing_pool {
+  public:
+    using job = std::function<void()>;
+
+    // Pool counters
+    struct statistics {
+        uint64_t jobs;    // jobs run
+        uint64_t steals;  // jobs taken from another worker's queue
+        size_t pinned;    // workers bound to their requested core
+    };
+
+    /**
+     * \brief Construct a pool with unpinned workers
+     *
+     * \param workers number of worker threads. Zero runs every batch on the calling thread.
+     */
+    explicit work_stealing_pool(size_t workers)
+        : work_stealing_pool(std::vector<int>(workers, -1)) { }
+
+    /**
+     * \brief Construct a pool with one worker bound to each listed core. Leave out the core the matrix refresh thread
+     *        runs on so rendering never competes with it. A core of -1 leaves that worker unpinned.
+     *
+     * \param cores core index for each worker
+     * \param on_start run first on every worker thread with its index, for example to set its scheduling policy
+     */
+    explicit work_stealing_pool(const std::vector<int>& cores, std::function<void(size_t worker)> on_start = nullptr)
+        : on_start(std::move(on_start))
+        , queued(0)
+        , stopping(false)
+        , job_count(0)
+        , steal_count(0)
+        , pinned_count(0) {
+        for ( size_t i = 0; i < cores.size(); i++ ) {
+            queues.push_back(std::make_unique<worker_queue>());
+        }
+        for ( size_t i = 0; i < cores.size(); i++ ) {
+            threads.emplace_back([this, i] { worker_loop(i); });
+            if ( (cores[i] >= 0) && pin(threads.back(), cores[i]) ) {
+                pinned_count++;
+            }
+        }
+    }
+
+    work_stealing_pool(const work_stealing_pool&) = delete;
+    work_stealing_pool& operator=(const work_stealing_pool&) = delete;
+
+    ~work_stealing_pool() {
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            stopping = true;
+        }
+        wake.notify_all();
+        for ( auto& thread : threads ) {
+            thread.join();
+        }
+    }
+
+    /**
+     * \brief run body(i) for every i in [0, count) across the pool and wait for all of them to finish. The body must be
+     *        safe to run concurrently for different indices and must not throw.
+     *
+     * \param count number of jobs
+     * \param body function called with each job index
+     */
+    template <typename Function>
+    void parallel_for(size_t count, Function&& body) {
+        if ( count == 0 ) {
+            return;
+        }
+        if ( queues.empty() ) {
+            for ( size_t i = 0; i < count; i++ ) {
+                body(i);
+            }
+            job_count += count;
+            return;
+        }
+
+        batch work{count};
+        // the count only changes under the batch mutex, so the caller can not see it reach zero and destroy the batch
+        // until the last job has finished touching it
+        auto run = [&work, &body](size_t index) {
+            body(index);
+            std::lock_guard<std::mutex> lock{work.mutex};
+            if ( --work.remaining == 0 ) {
+                work.done.notify_all();
+            }
+        };
+
+        // deal the jobs out in contiguous blocks so neighbouring tiles start on the same worker
+        auto per_queue = (count + queues.size() - 1) / queues.size();
+        for ( size_t q = 0; q < queues.size(); q++ ) {
+            auto first = q * per_queue;
+            auto last = std::min(count, first + per_queue);
+            if ( first >= last ) {
+                break;
+            }
+            std::lock_guard<std::mutex> lock{queues[q]->mutex};
+            for ( auto i = first; i < last; i++ ) {
+                queues[q]->jobs.emplace_back([&run, i] { run(i); });
+            }
+            queued.fetch_add(last - first, std::memory_order_release);
+        }
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+        }
+        wake.notify_all();
+
+        // help out until the queues run dry, then wait for jobs still running on the workers
+        job next;
+        while ( steal(queues.size(), next) ) {
+            next();
+            next = nullptr;
+        }
+        std::unique_lock<std::mutex> lock{work.mutex};
+        work.done.wait(lock, [&work] { return work.remaining == 0; });
+    }
+
+    // Get the number of worker threads, not counting the thread that calls parallel_for
+    size_t workers(void) const {
+        return threads.size();
+    }
+
+    // Get the pool counters
+    statistics stats(void) const {
+        return statistics{job_count.load(), steal_count.load(), pinned_count};
+    }
+
+  private:
+    struct worker_queue {
+        std::mutex mutex;
+        std::deque<job> jobs;
+    };
+
+    struct batch {
+        explicit batch(size_t count)
+            : remaining(count) { }
+
+        size_t remaining;  // guarded by mutex
+        std::mutex mutex;
+        std::condition_variable done;
+    };
+
+    static bool pin(std::thread& thread, int core) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(core, &set);
+        return pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set) == 0;
+    }
+
+    void worker_loop(size_t index) {
+        if ( on_start ) {
+            on_start(index);
+        }
+        job next;
+        while ( true ) {
+            if ( pop(index, next) || steal(index, next) ) {
+                next();
+                next = nullptr;
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock{mutex};
+            wake.wait(lock, [this] { return stopping || (queued.load(std::memory_order_acquire) > 0); });
+            if ( stopping && (queued.load(std::memory_order_acquire) == 0) ) {
+                return;
+            }
+        }
+    }
+
+    // take the newest job from a worker's own queue
+    bool pop(size_t index, job& out) {
+        auto& queue = *queues[index];
+        std::lock_guard<std::mutex> lock{queue.mutex};
+        if ( queue.jobs.empty() ) {
+            return false;
+        }
+        out = std::move(queue.jobs.back());
+        queue.jobs.pop_back();
+        queued.fetch_sub(1, std::memory_order_acq_rel);
+        job_count++;
+        return true;
+    }
+
+    // take the oldest job from any other queue, starting after the thief's own
+    bool steal(size_t thief, job& out) {
+        for ( size_t n = 1; n <= queues.size(); n++ ) {
+            auto victim = (thief + n) % queues.size();
+            if ( victim == thief ) {
+                continue;
+            }
+            auto& queue = *queues[victim];
+            std::lock_guard<std::mutex> lock{queue.mutex};
+            if ( queue.jobs.empty() ) {
+                continue;
+            }
+            out = std::move(queue.jobs.front());
+            queue.jobs.pop_front();
+            queued.fetch_sub(1, std::memory_order_acq_rel);
+            job_count++;
+            steal_count++;
+            return true;
+        }
+        return false;
+    }
+
+    std::function<void(size_t)> on_start;
+    std::vector<std::unique_ptr<worker_queue>> queues;
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::atomic<size_t> queued;
+    bool stopping;
+    std::atomic<uint64_t> job_count;
+    std::atomic<uint64_t> steal_count;
+    size_t pinned_count;
+};
+
+};  // namespace tasks
@@ -0,0 +1,147 @@
+// RGB LED Matrix Graphics Library
+
+#include "animator.hpp"
+#include <algorithm>
+
+namespace graphics
+{
+//-----------------------------------------------------------------------------
+animator::animator()
+    : m_next_id(1) { }
+
+//-----------------------------------------------------------------------------
+animator::track_id animator::animate_origin(std::shared_ptr<shape> target, const std::vector<keyframe<origin>>& keys, time_point start, bool loop) {
+    track item{0, property::origin, std::move(target), nullptr, pixel{0, 0, 0}, start, loop, {}, {}, false};
+    for ( const auto& frame : keys ) {
+        item.keys.push_back(key{frame.time_ms, {frame.value.x, frame.value.y, 0}, frame.curve});
+    }
+    return add(std::move(item));
+}
+
+//-----------------------------------------------------------------------------
+animator::track_id animator::animate_color(std::shared_ptr<span_shape> target, const std::vector<keyframe<pixel>>& keys, time_point start, bool loop) {
+    auto spans = target.get();
+    track item{0, property::color, std::move(target), spans, pixel{0, 0, 0}, start, loop, {}, {}, false};
+    for ( const auto& frame : keys ) {
+        item.keys.push_back(key{frame.time_ms, {frame.value.red, frame.value.green, frame.value.blue}, frame.curve});
+    }
+    return add(std::move(item));
+}
+
+//-----------------------------------------------------------------------------
+animator::track_id animator::animate_opacity(std::shared_ptr<span_shape> target,
+                                             const pixel& color,
+                                             const std::vector<keyframe<uint8_t>>& keys,
+                                             time_point start,
+                                             bool loop) {
+    auto spans = target.get();
+    track item{0, property::opacity, std::move(target), spans, color, start, loop, {}, {}, false};
+    for ( const auto& frame : keys ) {
+        item.keys.push_back(key{frame.time_ms, {frame.value, 0, 0}, frame.curve});
+    }
+    return add(std::move(item));
+}
+
+//-----------------------------------------------------------------------------
+animator::track_id animator::add(track&& item) {
+    if ( item.keys.empty() || !item.item ) {
+        return 0;
+    }
+    item.id = m_next_id++;
+    m_tracks.push_back(std::move(item));
+    return m_tracks.back().id;
+}
+
+//-----------------------------------------------------------------------------
+bool animator::cancel(track_id id) {
+    auto it = std::find_if(m_tracks.begin(), m_tracks.end(), [id](const auto& item) { return item.id == id; });
+    if ( it == m_tracks.end() ) {
+        return false;
+    }
+    m_tracks.erase(it);
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+bool animator::is_running(track_id id) const {
+    return std::any_of(m_tracks.begin(), m_tracks.end(), [id](const auto& item) { return item.id == id; });
+}
+
+//-----------------------------------------------------------------------------
+std::size_t animator::update(time_point now) {
+    for ( std::size_t i = 0; i < m_tracks.size(); ) {
+        auto& item = m_tracks[i];
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - item.start).count();
+        auto length = static_cast<int64_t>(item.keys.back().time_ms);
+        if ( elapsed < 0 ) {
+            i++;
+            continue;
+        }
+        if ( item.loop && (length > 0) ) {
+            elapsed %= length;
+        }
+
+        // past the last keyframe the track settles on it and finishes
+        if ( elapsed >= length ) {
+            apply(item, item.keys.back().value);
+            if ( !item.loop ) {
+                m_tracks.erase(m_tracks.begin() + static_cast<std::ptrdiff_t>(i));
+                continue;
+            }
+            i++;
+            continue;
+        }
+
+        // keyframes are few, so a linear search for the segment is cheaper than anything cleverer
+        std::size_t next = 0;
+        while ( item.keys[next].time_ms <= elapsed ) {
+            next++;
+        }
+        if ( next == 0 ) {
+            apply(item, item.keys[0].value);
+            i++;
+            continue;
+        }
+
+        const auto& from = item.keys[next - 1];
+        const auto& to = item.keys[next];
+        auto progress = static_cast<int32_t>(((elapsed - from.time_ms) << 16) / (to.time_ms - from.time_ms));
+        auto eased = ease(to.curve, progress);
+        std::array<int32_t, 3> value{};
+        for ( std::size_t c = 0; c < value.size(); c++ ) {
+            value[c] = from.value[c] + static_cast<int32_t>((static_cast<int64_t>(to.value[c] - from.value[c]) * eased) >> 16);
+        }
+        apply(item, value);
+        i++;
+    }
+    return m_tracks.size();
+}
+
+//-----------------------------------------------------------------------------
+void animator::apply(track& item, const std::array<int32_t, 3>& value) {
+    if ( item.written && (value == item.applied) ) {
+        return;
+    }
+    item.applied = value;
+    item.written = true;
+
+    auto channel = [](int32_t v) { return static_cast<uint8_t>(std::clamp(v, 0, 255)); };
+    switch ( item.target ) {
+        case property::origin:
+            item.item->set_origin(origin{static_cast<uint16_t>(std::max(value[0], 0)), static_cast<uint16_t>(std::max(value[1], 0))});
+            break;
+
+        case property::color:
+            item.spans->set_color(pixel{channel(value[0]), channel(value[1]), channel(value[2])});
+            break;
+
+        case property::opacity: {
+            auto alpha = channel(value[0]);
+            auto scale = [alpha](uint8_t c) { return static_cast<uint8_t>((c * (alpha + 1)) >> 8); };
+            item.spans->set_color(pixel{scale(item.color.red), scale(item.color.green), scale(item.color.blue)});
+            break;
+        }
+    }
+}
+
+};  // namespace graphics
@@ -0,0 +1,129 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "easing.hpp"
+#include "origin.hpp"
+#include "pixel.hpp"
+#include "shape.hpp"
+#include "span_shape.hpp"
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace graphics
+{
+
+// Value of a track at a point in time. The curve eases the motion from the previous keyframe into this one.
+template <typename T>
+struct keyframe {
+    uint32_t time_ms;  // offset from the start of the track
+    T value;
+    easing curve;
+};
+
+// Runs keyframe tracks on shape properties. Nothing runs on its own: the frame loop calls update with the frame
+// time and every track is evaluated in one pass over a flat list, with easing read from fixed point tables and values
+// interpolated in integers. A property is only written, and its shape's revision only bumped, when its value changes.
+class animator {
+  public:
+    using clock = std::chrono::steady_clock;
+    using time_point = clock::time_point;
+
+    // Identifier of a track
+    using track_id = uint32_t;
+
+    // Construct a new animator
+    animator();
+
+    /**
+     * \brief move a shape along keyframes
+     *
+     * \param target the shape to move
+     * \param keys positions in time order. The first key is the position at the start of the track.
+     * \param start time the track starts
+     * \param loop restart the track after the last keyframe instead of finishing
+     * \retval track_id identifier of the track
+     */
+    track_id animate_origin(std::shared_ptr<shape> target, const std::vector<keyframe<origin>>& keys, time_point start, bool loop = false);
+
+    /**
+     * \brief change the color of a span shape along keyframes
+     *
+     * \param target the shape to color
+     * \param keys colors in time order
+     * \param start time the track starts
+     * \param loop restart the track after the last keyframe instead of finishing
+     * \retval track_id identifier of the track
+     */
+    track_id animate_color(std::shared_ptr<span_shape> target, const std::vector<keyframe<pixel>>& keys, time_point start, bool loop = false);
+
+    /**
+     * \brief fade a span shape along keyframes. An LED that is off shows nothing, so opacity scales the shape's color
+     *        towards black, with 255 drawing the color given here unchanged.
+     *
+     * \param target the shape to fade
+     * \param color the color at full opacity
+     * \param keys opacities in time order
+     * \param start time the track starts
+     * \param loop restart the track after the last keyframe instead of finishing
+     * \retval track_id identifier of the track
+     */
+    track_id animate_opacity(std::shared_ptr<span_shape> target, const pixel& color, const std::vector<keyframe<uint8_t>>& keys, time_point start, bool loop = false);
+
+    // Stop a track where it is. Returns false if the track already finished.
+    bool cancel(track_id id);
+
+    /**
+     * \brief evaluate every track at a frame time and apply the values that changed. Finished tracks are applied at
+     *        their last keyframe and removed.
+     *
+     * \param now the frame time
+     * \retval std::size_t number of tracks still running
+     */
+    std::size_t update(time_point now);
+
+    // Check if a track is still running
+    bool is_running(track_id id) const;
+
+    // Get the number of running tracks
+    std::size_t size() const {
+        return m_tracks.size();
+    }
+
+  private:
+    // What a track writes
+    enum class property : uint8_t { origin, color, opacity };
+
+    // Keyframe with its value as up to three integer channels
+    struct key {
+        uint32_t time_ms;
+        std::array<int32_t, 3> value;
+        easing curve;
+    };
+
+    struct track {
+        track_id id;
+        property target;
+        std::shared_ptr<shape> item;
+        span_shape* spans;  // the item as a span shape, for color and opacity tracks
+        pixel color;        // full opacity color of opacity tracks
+        time_point start;
+        bool loop;
+        std::vector<key> keys;
+        std::array<int32_t, 3> applied;  // last value written
+        bool written;
+    };
+
+    track_id add(track&& item);
+
+    // Write a value to the track's property if it changed
+    void apply(track& item, const std::array<int32_t, 3>& value);
+
+    std::vector<track> m_tracks;
+    track_id m_next_id;
+};
+
+};  // namespace graphics
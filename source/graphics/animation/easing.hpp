@@ -0,0 +1,98 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "math_utilities.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace graphics
+{
+
+// Easing curves. Curves map progress through a tween to progress through its values and may overshoot, as back_out
+// does, before settling on the end value.
+enum class easing : uint8_t {
+    linear,
+    quad_in,
+    quad_out,
+    quad_in_out,
+    cubic_in_out,
+    sine_in_out,
+    back_out,
+    bounce_out,
+};
+
+// Fixed point one for progress and eased values
+constexpr int32_t easing_one = 1 << 16;
+
+// Eased value of an easing curve sampled at 257 evenly spaced points from 0 to 1, in 16.16 fixed point
+using easing_table = std::array<int32_t, 257>;
+
+/**
+ * \brief sample an easing curve into a table at compile time
+ *
+ * \param curve the curve, mapping [0, 1] to its eased value
+ * \retval constexpr easing_table
+ */
+template <typename Curve>
+constexpr easing_table make_easing_table(Curve curve) {
+    easing_table table{};
+    for ( int i = 0; i <= 256; i++ ) {
+        table[i] = math_helpers::round(curve(i / 256.0) * easing_one);
+    }
+    return table;
+}
+
+namespace easing_curves
+{
+constexpr double bounce_out(double x) {
+    constexpr double n = 7.5625;
+    constexpr double d = 2.75;
+    if ( x < 1 / d ) {
+        return n * x * x;
+    } else if ( x < 2 / d ) {
+        x -= 1.5 / d;
+        return n * x * x + 0.75;
+    } else if ( x < 2.5 / d ) {
+        x -= 2.25 / d;
+        return n * x * x + 0.9375;
+    }
+    x -= 2.625 / d;
+    return n * x * x + 0.984375;
+}
+};  // namespace easing_curves
+
+// Tables for every easing curve, in the order of the easing enumeration
+inline constexpr std::array<easing_table, 8> easing_tables = {
+    make_easing_table([](double x) { return x; }),
+    make_easing_table([](double x) { return x * x; }),
+    make_easing_table([](double x) { return 1 - (1 - x) * (1 - x); }),
+    make_easing_table([](double x) { return (x < 0.5) ? 2 * x * x : 1 - 2 * (1 - x) * (1 - x); }),
+    make_easing_table([](double x) { return (x < 0.5) ? 4 * x * x * x : 1 - 4 * (1 - x) * (1 - x) * (1 - x); }),
+    make_easing_table([](double x) { return 0.5 - math_helpers::cos(math_helpers::pi * x) / 2; }),
+    make_easing_table([](double x) { return 1 + 2.70158 * (x - 1) * (x - 1) * (x - 1) + 1.70158 * (x - 1) * (x - 1); }),
+    make_easing_table([](double x) { return easing_curves::bounce_out(x); }),
+};
+
+/**
+ * \brief ease a progress value by interpolating between the two nearest table entries
+ *
+ * \param curve the easing curve
+ * \param progress progress through the tween from 0 to easing_one
+ * \retval constexpr int32_t eased progress, easing_one at the end value
+ */
+constexpr int32_t ease(easing curve, int32_t progress) {
+    const auto& table = easing_tables[static_cast<std::size_t>(curve)];
+    if ( progress <= 0 ) {
+        return table[0];
+    }
+    if ( progress >= easing_one ) {
+        return table[256];
+    }
+    auto index = progress >> 8;
+    auto fraction = progress & 0xFF;
+    return table[index] + (((table[index + 1] - table[index]) * fraction) >> 8);
+}
+
+};  // namespace graphics
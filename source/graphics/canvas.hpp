@@ -3,7 +3,12 @@
 #pragma once
 
 #include "canvas.h"
+#include "framebuffer.hpp"
 #include "pixel.hpp"
+#include "rect.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
 
 namespace graphics {
 
@@ -12,22 +17,129 @@ namespace graphics {
 class canvas {
   public:
     // Create a new canvas from an RGB led matrix library canvas
-    canvas(rgb_matrix::Canvas* canvas)
-        : m_canvas(canvas) {}
+    canvas(rgb_matrix::Canvas* target)
+        : canvas(target, rect{0, 0, static_cast<uint16_t>(target->width()), static_cast<uint16_t>(target->height())}) {}
+
+    // Create a canvas that only draws inside a clip rectangle. Coordinates stay those of the whole canvas, so several
+    // clipped canvases over one frame buffer can be drawn from different threads as long as their clips do not overlap.
+    canvas(rgb_matrix::Canvas* target, const rect& clip)
+        : m_canvas(target)
+        , m_framebuffer(dynamic_cast<framebuffer*>(target))
+        , m_clip(intersect(clip, rect{0, 0, static_cast<uint16_t>(target->width()), static_cast<uint16_t>(target->height())}))
+        , m_dx(0)
+        , m_dy(0) {}
+
+    // Get a copy of the canvas that only draws inside an area given in this canvas' coordinates
+    canvas clipped(const rect& area) const {
+        auto copy = *this;
+        copy.m_clip = intersect(m_clip, rect{static_cast<int16_t>(area.x + m_dx), static_cast<int16_t>(area.y + m_dy), area.width, area.height});
+        return copy;
+    }
+
+    // Get a copy of the canvas that draws everything moved by (dx, dy). Used to draw shapes relative to a parent.
+    canvas translated(int dx, int dy) const {
+        auto copy = *this;
+        copy.m_dx += dx;
+        copy.m_dy += dy;
+        return copy;
+    }
 
     // Set a pixel to a color value
     void set_pixel(int x, int y, const pixel& color) {
-        if ( (x < m_canvas->width()) && (y < m_canvas->height()) ) {
+        x += m_dx;
+        y += m_dy;
+        if ( contains(m_clip, x, y) ) {
             m_canvas->SetPixel(x, y, color.red, color.green, color.blue);
         }
     }
 
     // Set a pixel to a color
     void set_pixel(int x, int y, uint8_t red, uint8_t green, uint8_t blue) {
-    if ( (x < m_canvas->width()) && (y < m_canvas->height()) ) {
-        m_canvas->SetPixel(x, y, red, green, blue);
+        x += m_dx;
+        y += m_dy;
+        if ( contains(m_clip, x, y) ) {
+            m_canvas->SetPixel(x, y, red, green, blue);
+        }
+    }
+
+    // Fill a horizontal run of pixels starting at (x, y). The span is clipped to the canvas.
+    void fill_span(int x, int y, int length, const pixel& color) {
+        fill_row(x + m_dx, y + m_dy, length, color);
+    }
+
+    // Copy a row of packed pixels to the canvas starting at (x, y), clipped to the canvas. If a mask row is given only
+    // pixels whose mask bit is set are copied. Mask bits are stored most significant bit first.
+    void blit_row(int x, int y, const packed_pixel* pixels, int length, const uint8_t* mask = nullptr) {
+        x += m_dx;
+        y += m_dy;
+        if ( (y < m_clip.y) || (y >= m_clip.y + m_clip.height) ) {
+            return;
+        }
+        auto start = std::max(x, static_cast<int>(m_clip.x));
+        auto end = std::min(x + length, m_clip.x + m_clip.width);
+
+        if ( (m_framebuffer != nullptr) && (mask == nullptr) ) {
+            if ( start < end ) {
+                std::copy(pixels + (start - x), pixels + (end - x), m_framebuffer->row(y) + start);
+            }
+            return;
+        }
+
+        auto row = (m_framebuffer != nullptr) ? m_framebuffer->row(y) : nullptr;
+        for ( int i = start; i < end; i++ ) {
+            auto index = i - x;
+            if ( (mask != nullptr) && !(mask[index >> 3] & (0x80 >> (index & 0x07))) ) {
+                continue;
+            }
+            auto color = pixels[index];
+            if ( row != nullptr ) {
+                row[i] = color;
+            } else {
+                m_canvas->SetPixel(i, y, red_channel(color), green_channel(color), blue_channel(color));
+            }
+        }
+    }
+
+    // Shift the pixels inside an area by (dx, dy) and fill the strip that is exposed. Positive values scroll right and
+    // down. The area is clipped to the canvas and pixels outside of it are never touched. On a frame buffer each row is
+    // moved in place, so only the exposed strip needs to be redrawn afterwards. The live matrix cannot be read back, so
+    // there the whole area is filled and false is returned to tell the caller to redraw all of it.
+    bool scroll_region(const rect& area, int dx, int dy, const pixel& fill) {
+        auto visible = intersect(rect{static_cast<int16_t>(area.x + m_dx), static_cast<int16_t>(area.y + m_dy), area.width, area.height}, m_clip);
+        if ( is_empty(visible) ) {
+            return true;
+        }
+
+        auto left = static_cast<int>(visible.x);
+        auto right = left + visible.width;
+        if ( (m_framebuffer == nullptr) || (std::abs(dx) >= visible.width) || (std::abs(dy) >= visible.height) ) {
+            for ( int y = visible.y; y < visible.y + visible.height; y++ ) {
+                fill_row(left, y, visible.width, fill);
+            }
+            return m_framebuffer != nullptr;
+        }
+
+        // columns of each row that receive moved pixels
+        auto start = std::max(left, left + dx);
+        auto end = std::min(right, right + dx);
+        auto color = pack(fill);
+
+        // walk rows against the scroll direction so source rows are read before they are overwritten
+        for ( int i = 0; i < visible.height; i++ ) {
+            auto y = (dy > 0) ? visible.y + visible.height - 1 - i : visible.y + i;
+            auto row = m_framebuffer->row(y);
+            auto source_y = y - dy;
+            if ( (source_y < visible.y) || (source_y >= visible.y + visible.height) ) {
+                std::fill(row + left, row + right, color);
+                continue;
+            }
+
+            std::memmove(row + start, m_framebuffer->row(source_y) + start - dx, (end - start) * sizeof(packed_pixel));
+            std::fill(row + left, row + start, color);
+            std::fill(row + end, row + right, color);
+        }
+        return true;
     }
-}
 
     // Get the canvas width
     int width(void) const {
@@ -39,18 +151,62 @@ class canvas {
         return m_canvas->height();
     }
 
+    // Get the area drawing is clipped to
+    rect clip(void) const {
+        return m_clip;
+    }
+
     // Clear the display
     void clear(void) {
-        m_canvas->Clear();
+        if ( is_clipped() ) {
+            fill(0, 0, 0);
+        } else {
+            m_canvas->Clear();
+        }
     }
 
     // Uniformly fill to a specific color
     void fill(uint8_t red, uint8_t green, uint8_t blue) {
-        m_canvas->Fill(red, green, blue);
+        if ( !is_clipped() ) {
+            m_canvas->Fill(red, green, blue);
+            return;
+        }
+        for ( int y = m_clip.y; y < m_clip.y + m_clip.height; y++ ) {
+            fill_row(m_clip.x, y, m_clip.width, pixel{red, green, blue});
+        }
     }
 
   private:
+    // Fill a run of pixels given in the coordinates of the underlying canvas, clipped to the clip rectangle
+    void fill_row(int x, int y, int length, const pixel& color) {
+        if ( (y < m_clip.y) || (y >= m_clip.y + m_clip.height) ) {
+            return;
+        }
+        auto start = std::max(x, static_cast<int>(m_clip.x));
+        auto end = std::min(x + length, m_clip.x + m_clip.width);
+        if ( start >= end ) {
+            return;
+        }
+
+        if ( m_framebuffer != nullptr ) {
+            auto row = m_framebuffer->row(y);
+            std::fill(row + start, row + end, pack(color));
+        } else {
+            for ( int i = start; i < end; i++ ) {
+                m_canvas->SetPixel(i, y, color.red, color.green, color.blue);
+            }
+        }
+    }
+
+    bool is_clipped(void) const {
+        return (m_clip.width != m_canvas->width()) || (m_clip.height != m_canvas->height());
+    }
+
     rgb_matrix::Canvas* m_canvas;
+    framebuffer* m_framebuffer;  // set when drawing off-screen, enables direct row access
+    rect m_clip;                 // drawing outside of this area is discarded
+    int m_dx;                    // offset added to every coordinate drawn
+    int m_dy;
 };
 
 
@@ -0,0 +1,21 @@
+// RGB LED Matrix Graphics Library
+
+#include "bar_chart.hpp"
+
+namespace graphics
+{
+//-----------------------------------------------------------------------------
+bar_chart::bar_chart(const origin& origin, int width, int height, int bar_width, int gap, const pixel& color, const pixel& background)
+    : chart(origin, width, height, bar_width + gap, color, background)
+    , m_bar_width(bar_width) { }
+
+//-----------------------------------------------------------------------------
+void bar_chart::draw_column(canvas& plot, int x, std::size_t index) {
+    // the gap sits on the left of each bar so the newest bar is flush with the right edge
+    auto left = x + m_column_width - m_bar_width;
+    for ( int y = value_to_row(samples()[index]); y < plot.height(); y++ ) {
+        plot.fill_span(left, y, m_bar_width, m_color);
+    }
+}
+
+};  // namespace graphics
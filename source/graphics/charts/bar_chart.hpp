@@ -0,0 +1,33 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "chart.hpp"
+
+namespace graphics
+{
+
+// Bar chart with a filled bar per sample rising from the bottom of the chart
+class bar_chart : public chart {
+  public:
+    /**
+     * \brief Construct a new bar chart
+     *
+     * \param origin top-left corner of the chart
+     * \param width width of the chart in pixels
+     * \param height height of the chart in pixels
+     * \param bar_width width of each bar in pixels
+     * \param gap pixels between bars
+     * \param color color of the bars
+     * \param background color behind the bars
+     */
+    bar_chart(const origin& origin, int width, int height, int bar_width, int gap, const pixel& color, const pixel& background = {0, 0, 0});
+
+  protected:
+    void draw_column(canvas& plot, int x, std::size_t index) override;
+
+  private:
+    int m_bar_width;
+};
+
+};  // namespace graphics
@@ -0,0 +1,126 @@
+// RGB LED Matrix Graphics Library
+
+#include "chart.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace graphics
+{
+//-----------------------------------------------------------------------------
+chart::chart(const origin& origin, int width, int height, int column_width, const pixel& color, const pixel& background)
+    : shape(origin)
+    , m_column_width(std::max(column_width, 1))
+    , m_color(color)
+    , m_background(background)
+    , m_plot(width, height)
+    , m_samples(static_cast<std::size_t>(width / std::max(column_width, 1)))
+    , m_autoscale(true)
+    , m_minimum(0)
+    , m_maximum(0)
+    , m_redraw(true)
+    , m_pending(0)
+    , m_full_redraws(0)
+    , m_column_draws(0) { }
+
+//-----------------------------------------------------------------------------
+void chart::add_sample(float value) {
+    m_samples.push(value);
+    m_pending++;
+    if ( update_range() ) {
+        m_redraw = true;
+    }
+    touch();
+}
+
+//-----------------------------------------------------------------------------
+void chart::set_range(float minimum, float maximum) {
+    m_autoscale = false;
+    m_minimum = minimum;
+    m_maximum = maximum;
+    m_redraw = true;
+    touch();
+}
+
+//-----------------------------------------------------------------------------
+void chart::set_autoscale() {
+    m_autoscale = true;
+    update_range();
+    m_redraw = true;
+    touch();
+}
+
+//-----------------------------------------------------------------------------
+void chart::clear() {
+    m_samples.clear();
+    update_range();
+    m_redraw = true;
+    touch();
+}
+
+//-----------------------------------------------------------------------------
+bool chart::update_range() {
+    if ( !m_autoscale || m_samples.empty() ) {
+        return false;
+    }
+
+    auto minimum = m_samples[0];
+    auto maximum = m_samples[0];
+    for ( std::size_t i = 1; i < m_samples.size(); i++ ) {
+        minimum = std::min(minimum, m_samples[i]);
+        maximum = std::max(maximum, m_samples[i]);
+    }
+
+    if ( (minimum == m_minimum) && (maximum == m_maximum) ) {
+        return false;
+    }
+    m_minimum = minimum;
+    m_maximum = maximum;
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+int chart::value_to_row(float value) const {
+    auto bottom = m_plot.height() - 1;
+    if ( m_maximum <= m_minimum ) {
+        return bottom / 2;
+    }
+    auto scaled = std::lround((value - m_minimum) * bottom / (m_maximum - m_minimum));
+    return bottom - std::clamp(static_cast<int>(scaled), 0, bottom);
+}
+
+//-----------------------------------------------------------------------------
+void chart::redraw() {
+    canvas plot{&m_plot};
+    plot.fill(m_background.red, m_background.green, m_background.blue);
+
+    auto x = m_plot.width() - static_cast<int>(m_samples.size()) * m_column_width;
+    for ( std::size_t i = 0; i < m_samples.size(); i++, x += m_column_width ) {
+        draw_column(plot, x, i);
+    }
+    m_full_redraws++;
+}
+
+//-----------------------------------------------------------------------------
+void chart::draw(canvas& canvas) {
+    if ( m_redraw || (m_pending >= m_samples.capacity()) ) {
+        redraw();
+    } else if ( m_pending > 0 ) {
+        graphics::canvas plot{&m_plot};
+        auto shift = static_cast<int>(m_pending) * m_column_width;
+        plot.scroll_region(rect{0, 0, static_cast<uint16_t>(m_plot.width()), static_cast<uint16_t>(m_plot.height())}, -shift, 0, m_background);
+
+        auto x = m_plot.width() - shift;
+        for ( auto i = m_samples.size() - m_pending; i < m_samples.size(); i++, x += m_column_width ) {
+            draw_column(plot, x, i);
+            m_column_draws++;
+        }
+    }
+    m_redraw = false;
+    m_pending = 0;
+
+    for ( int y = 0; y < m_plot.height(); y++ ) {
+        canvas.blit_row(m_origin.x, m_origin.y + y, m_plot.row(y), m_plot.width());
+    }
+}
+
+};  // namespace graphics
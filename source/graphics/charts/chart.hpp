@@ -0,0 +1,115 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "framebuffer.hpp"
+#include "pixel.hpp"
+#include "ring_buffer.hpp"
+#include "shape.hpp"
+#include <cstdint>
+
+namespace graphics
+{
+
+// Base class for rolling charts of a series of samples. The newest sample is drawn at the right edge and older
+// samples move left. The chart keeps its plot in its own frame: a new sample scrolls the plot left by one column and
+// rasterizes only the new column. The whole plot is redrawn only when the vertical range changes.
+class chart : public shape {
+  public:
+    /**
+     * \brief Construct a new chart
+     *
+     * \param origin top-left corner of the chart
+     * \param width width of the chart in pixels
+     * \param height height of the chart in pixels
+     * \param column_width pixels per sample
+     * \param color color of the plot
+     * \param background color behind the plot
+     */
+    chart(const origin& origin, int width, int height, int column_width, const pixel& color, const pixel& background);
+
+    /**
+     * \brief add a sample to the right of the chart
+     *
+     * \param value the sample
+     */
+    void add_sample(float value);
+
+    /**
+     * \brief use a fixed vertical range instead of scaling to the samples
+     *
+     * \param minimum value drawn at the bottom of the chart
+     * \param maximum value drawn at the top of the chart
+     */
+    void set_range(float minimum, float maximum);
+
+    // Scale the vertical range to the samples on the chart
+    void set_autoscale();
+
+    // Remove all samples
+    void clear();
+
+    // Bring the plot up to date and draw it on the canvas
+    void draw(canvas& canvas) override;
+
+    // Get the area covered by the plot
+    rect bounds() const override {
+        return rect{static_cast<int16_t>(m_origin.x), static_cast<int16_t>(m_origin.y), static_cast<uint16_t>(m_plot.width()), static_cast<uint16_t>(m_plot.height())};
+    }
+
+    // Get the samples on the chart, oldest first
+    const ring_buffer<float>& samples() const {
+        return m_samples;
+    }
+
+    // Get the number of times the whole plot has been redrawn
+    uint64_t full_redraws() const {
+        return m_full_redraws;
+    }
+
+    // Get the number of single columns rasterized by scrolling updates
+    uint64_t column_draws() const {
+        return m_column_draws;
+    }
+
+  protected:
+    /**
+     * \brief rasterize the column of one sample onto the plot
+     *
+     * \param plot canvas of the chart's plot
+     * \param x left edge of the column
+     * \param index index of the sample, oldest first
+     */
+    virtual void draw_column(canvas& plot, int x, std::size_t index) = 0;
+
+    /**
+     * \brief map a value to a row of the plot, clamped to the plot
+     *
+     * \param value the value
+     * \retval int the row, 0 at the top
+     */
+    int value_to_row(float value) const;
+
+    int m_column_width;
+    pixel m_color;
+    pixel m_background;
+
+  private:
+    // Recompute the range from the samples when autoscaling. Returns true if it changed.
+    bool update_range();
+
+    // Redraw every sample
+    void redraw();
+
+    framebuffer m_plot;
+    ring_buffer<float> m_samples;
+    bool m_autoscale;
+    float m_minimum;
+    float m_maximum;
+    bool m_redraw;
+    std::size_t m_pending;
+    uint64_t m_full_redraws;
+    uint64_t m_column_draws;
+};
+
+};  // namespace graphics
@@ -0,0 +1,23 @@
+// RGB LED Matrix Graphics Library
+
+#include "sparkline.hpp"
+#include <algorithm>
+
+namespace graphics
+{
+//-----------------------------------------------------------------------------
+sparkline::sparkline(const origin& origin, int width, int height, const pixel& color, const pixel& background)
+    : chart(origin, width, height, 1, color, background) { }
+
+//-----------------------------------------------------------------------------
+void sparkline::draw_column(canvas& plot, int x, std::size_t index) {
+    auto row = value_to_row(samples()[index]);
+    auto previous = (index > 0) ? value_to_row(samples()[index - 1]) : row;
+
+    // a vertical run covering the rows between the two samples keeps the line connected
+    for ( int y = std::min(row, previous); y <= std::max(row, previous); y++ ) {
+        plot.fill_span(x, y, 1, m_color);
+    }
+}
+
+};  // namespace graphics
@@ -0,0 +1,28 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "chart.hpp"
+
+namespace graphics
+{
+
+// Line chart with one pixel column per sample. Each column joins the previous sample to the current one.
+class sparkline : public chart {
+  public:
+    /**
+     * \brief Construct a new sparkline
+     *
+     * \param origin top-left corner of the chart
+     * \param width width of the chart in pixels, which is also the number of samples shown
+     * \param height height of the chart in pixels
+     * \param color color of the line
+     * \param background color behind the line
+     */
+    sparkline(const origin& origin, int width, int height, const pixel& color, const pixel& background = {0, 0, 0});
+
+  protected:
+    void draw_column(canvas& plot, int x, std::size_t index) override;
+};
+
+};  // namespace graphics
@@ -0,0 +1,250 @@
+// RGB LED Matrix Graphics Library
+
+#include "display_list.hpp"
+#include "alignment.hpp"
+#include "circle.hpp"
+#include "line.hpp"
+#include "rectangle.hpp"
+#include <algorithm>
+#include <numeric>
+#include <optional>
+
+namespace graphics
+{
+
+// All element types of a scene description
+enum class element_type : unsigned { fill, rectangle, line, circle, text };
+
+static const std::map<std::string, element_type> element_types = {{"fill", element_type::fill},
+                                                                   {"rectangle", element_type::rectangle},
+                                                                   {"line", element_type::line},
+                                                                   {"circle", element_type::circle},
+                                                                   {"text", element_type::text}};
+
+static const std::map<std::string, horizontal_alignment> horizontal_settings = {{"left", horizontal_alignment::left},
+                                                                                {"center", horizontal_alignment::center},
+                                                                                {"right", horizontal_alignment::right}};
+
+static const std::map<std::string, vertical_alignment> vertical_settings = {{"top", vertical_alignment::top},
+                                                                            {"center", vertical_alignment::center},
+                                                                            {"bottom", vertical_alignment::bottom}};
+
+
+// Parse an [red, green, blue] color of integer channels from 0 to 255
+static std::optional<pixel> parse_color(const json& value) {
+    auto is_channel = [](const json& item) { return item.is_number_integer() && (item.get<int64_t>() >= 0) && (item.get<int64_t>() <= 255); };
+    if ( !value.is_array() || (value.size() != 3) || !std::all_of(value.begin(), value.end(), is_channel) ) {
+        return {};
+    }
+    return pixel{value[0].get<uint8_t>(), value[1].get<uint8_t>(), value[2].get<uint8_t>()};
+}
+
+
+// Read an optional coordinate or size, defaulting to zero. Values are bounded well beyond any panel chain so a single
+// element can not compile into an unbounded number of spans.
+static std::optional<int> parse_extent(const json& element, const char* key, int minimum) {
+    if ( !element.contains(key) ) {
+        return 0;
+    }
+    const auto& value = element[key];
+    if ( !value.is_number() || (value.get<double>() < minimum) || (value.get<double>() > display_list::max_extent) ) {
+        return {};
+    }
+    return value.get<int>();
+}
+
+
+// Rasterize the lit pixels of a string into spans relative to the top-left corner of its box
+static std::vector<span> rasterize_text(const std::vector<fonts::character>& characters,
+                                        int width,
+                                        int height,
+                                        horizontal_alignment h_align,
+                                        vertical_alignment v_align) {
+    std::vector<span> spans;
+    if ( characters.empty() ) {
+        return spans;
+    }
+
+    // place the text the same way a text box does
+    int char_width = characters[0].properties.b_box.width;
+    int char_height = characters[0].properties.b_box.height;
+    int string_width = static_cast<int>(characters.size()) * char_width;
+    int x_position = 0;
+    int y_position = 0;
+    if ( string_width < width ) {
+        if ( h_align == horizontal_alignment::center ) {
+            x_position += (width - string_width) / 2;
+        } else if ( h_align == horizontal_alignment::right ) {
+            x_position += width - string_width;
+        }
+    }
+    if ( char_height < height ) {
+        if ( v_align == vertical_alignment::center ) {
+            y_position += (height - char_height) / 2;
+        } else if ( v_align == vertical_alignment::bottom ) {
+            y_position += height - char_height;
+        }
+    }
+
+    for ( const auto& character : characters ) {
+        const auto& bbox = character.properties.b_box;
+
+        // fonts larger than 8 bits are encoded as 16-bit values with padding right-aligned
+        unsigned pixel_shift = (bbox.width > 8) ? 15 : 7;
+        for ( int j = 0; (j < bbox.height) && (j < static_cast<int>(character.bitmap.size())); j++ ) {
+            auto bitmap = character.bitmap[j];
+            int run_start = -1;
+            for ( int i = 0; i <= bbox.width; i++ ) {
+                bool lit = (i < bbox.width) && (bitmap & (0x01u << (pixel_shift - i)));
+                if ( lit && (run_start < 0) ) {
+                    run_start = i;
+                } else if ( !lit && (run_start >= 0) ) {
+                    spans.push_back(span{static_cast<int16_t>(x_position + run_start), static_cast<int16_t>(y_position + j), static_cast<uint16_t>(i - run_start)});
+                    run_start = -1;
+                }
+            }
+        }
+        x_position += bbox.width;
+    }
+    return spans;
+}
+
+
+//-----------------------------------------------------------------------------
+expected<display_list, std::string> display_list::from_json(const json& description, const font_table& fonts) {
+    using expected_type = expected<display_list, std::string>;
+
+    display_list list;
+    try {
+        if ( description.contains("background") ) {
+            auto background = parse_color(description["background"]);
+            if ( !background ) {
+                return expected_type::error("background must be a [red, green, blue] color");
+            }
+            list.m_commands.push_back(display_command{display_op::clear, background.value(), 0, 0});
+        }
+        if ( !description.contains("elements") || !description["elements"].is_array() ) {
+            return expected_type::error("scene description has no elements list");
+        }
+
+        int index = 0;
+        for ( const auto& element : description["elements"] ) {
+            auto name = std::string{"element "} + std::to_string(index++);
+            auto type = element_types.find(element.value("type", std::string{}));
+            if ( type == element_types.end() ) {
+                return expected_type::error(name + " has an unknown type");
+            }
+            auto color = element.contains("color") ? parse_color(element["color"]) : std::optional<pixel>{};
+            if ( !color ) {
+                return expected_type::error(name + " needs a [red, green, blue] color");
+            }
+
+            // every coordinate and size is checked up front, whichever of them the element type uses
+            std::map<std::string, int> extents;
+            for ( const auto* key : {"x", "y", "x0", "y0", "x1", "y1"} ) {
+                auto value = parse_extent(element, key, -max_extent);
+                if ( !value ) {
+                    return expected_type::error(name + " needs " + key + " to be a number from " + std::to_string(-max_extent) + " to " + std::to_string(max_extent));
+                }
+                extents[key] = value.value();
+            }
+            for ( const auto* key : {"width", "height", "radius"} ) {
+                auto value = parse_extent(element, key, 0);
+                if ( !value ) {
+                    return expected_type::error(name + " needs " + key + " to be a number from 0 to " + std::to_string(max_extent));
+                }
+                extents[key] = value.value();
+            }
+
+            int x = extents["x"];
+            int y = extents["y"];
+            switch ( type->second ) {
+                case element_type::fill:
+                    list.add_spans(color.value(), rectangle{origin{0, 0}, extents["width"], extents["height"], color.value(), true}.spans(), x, y);
+                    break;
+
+                case element_type::rectangle:
+                    list.add_spans(color.value(), rectangle{origin{0, 0}, extents["width"], extents["height"], color.value(), element.value("filled", false)}.spans(), x, y);
+                    break;
+
+                case element_type::line: {
+                    point start{static_cast<int16_t>(extents["x0"]), static_cast<int16_t>(extents["y0"])};
+                    point end{static_cast<int16_t>(extents["x1"]), static_cast<int16_t>(extents["y1"])};
+                    list.add_spans(color.value(), line{origin{0, 0}, start, end, color.value()}.spans(), 0, 0);
+                    break;
+                }
+
+                case element_type::circle:
+                    list.add_spans(color.value(), circle{origin{0, 0}, extents["radius"], color.value(), element.value("filled", false)}.spans(), x, y);
+                    break;
+
+                case element_type::text: {
+                    auto font = fonts.find(element.value("font", std::string{}));
+                    if ( font == fonts.end() ) {
+                        return expected_type::error(name + " uses a font that is not loaded");
+                    }
+                    auto characters = font->second->encode_with_default(element.value("text", std::string{}), ' ');
+
+                    // text runs on past its box, so its own width is bounded like any other size to keep spans in range
+                    auto text_width = std::accumulate(characters.begin(), characters.end(), 0, [](int total, const fonts::character& character) {
+                        return total + character.properties.b_box.width;
+                    });
+                    if ( text_width > max_extent ) {
+                        return expected_type::error(name + " has text wider than " + std::to_string(max_extent) + " pixels");
+                    }
+                    auto h_align = horizontal_settings.find(element.value("align", std::string{"left"}));
+                    auto v_align = vertical_settings.find(element.value("valign", std::string{"top"}));
+                    auto spans = rasterize_text(characters,
+                                                extents["width"],
+                                                extents["height"],
+                                                (h_align != horizontal_settings.end()) ? h_align->second : horizontal_alignment::left,
+                                                (v_align != vertical_settings.end()) ? v_align->second : vertical_alignment::top);
+                    list.add_spans(color.value(), spans, x, y);
+                    break;
+                }
+            }
+        }
+    } catch ( const json::exception& error ) {
+        return expected_type::error(std::string{"invalid scene description: "} + error.what());
+    } catch ( const std::exception& error ) {
+        return expected_type::error(std::string{"scene description could not be compiled: "} + error.what());
+    }
+
+    list.m_commands.shrink_to_fit();
+    list.m_spans.shrink_to_fit();
+    return expected_type::success(std::move(list));
+}
+
+//-----------------------------------------------------------------------------
+void display_list::execute(canvas& canvas) const {
+    const auto* spans = m_spans.data();
+    for ( const auto& command : m_commands ) {
+        switch ( command.op ) {
+            case display_op::clear:
+                canvas.fill(command.color.red, command.color.green, command.color.blue);
+                break;
+
+            case display_op::spans:
+                for ( uint32_t i = command.first; i < command.first + command.count; i++ ) {
+                    canvas.fill_span(spans[i].x, spans[i].y, spans[i].length, command.color);
+                }
+                break;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+void display_list::add_spans(const pixel& color, const std::vector<span>& spans, int x, int y) {
+    if ( spans.empty() ) {
+        return;
+    }
+    if ( m_commands.empty() || (m_commands.back().op != display_op::spans) || !(m_commands.back().color == color) ) {
+        m_commands.push_back(display_command{display_op::spans, color, static_cast<uint32_t>(m_spans.size()), 0});
+    }
+    for ( const auto& item : spans ) {
+        m_spans.push_back(span{static_cast<int16_t>(item.x + x), static_cast<int16_t>(item.y + y), item.length});
+    }
+    m_commands.back().count += static_cast<uint32_t>(spans.size());
+}
+
+};  // namespace graphics
@@ -0,0 +1,144 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "canvas.hpp"
+#include "expected.hpp"
+#include "font.hpp"
+#include "nlohmann/json.hpp"
+#include "pixel.hpp"
+#include "span_shape.hpp"
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using json = nlohmann::json;
+
+namespace graphics
+{
+
+// Operation of a display list command
+enum class display_op : uint8_t {
+    clear,  // fill the whole canvas with the command color
+    spans,  // fill a range of the span table with the command color
+};
+
+// Display list command. Span commands refer to a range of the list's span table.
+struct display_command {
+    display_op op;
+    pixel color;
+    uint32_t first;
+    uint32_t count;
+};
+
+// Fonts a scene description can refer to, by name. Fonts are only read while a description is compiled.
+using font_table = std::map<std::string, fonts::font*>;
+
+// Layout compiled from a JSON scene description into a flat list of commands. Everything that can be worked out
+// ahead of time is: fonts are looked up by name, text is aligned and its glyphs rasterized, and shapes are rasterized,
+// all into spans at absolute positions held in one contiguous table. Executing the list is a single loop over the
+// commands that fills spans, with no lookups or allocation.
+//
+// A description is an object with an optional "background" color and a list of "elements". Each element has a
+// "type" of fill, rectangle, line, circle or text, a "color" as [red, green, blue] and the fields of its type:
+//   fill:      x, y, width, height
+//   rectangle: x, y, width, height, filled (default false)
+//   line:      x0, y0, x1, y1
+//   circle:    x, y, radius, filled (default false)
+//   text:      x, y, text, font, and optionally width, height, align (left, center, right) and valign (top, center,
+//              bottom) to place the text in a box
+// Coordinates must lie within +/-max_extent, and sizes and the width of any text within 0 to max_extent. Colors are
+// [red, green, blue] integers from 0 to 255.
+class display_list {
+  public:
+    // Largest coordinate or size a description may use
+    static constexpr int max_extent = 4096;
+
+    /**
+     * \brief compile a scene description
+     *
+     * \param description the JSON scene description
+     * \param fonts fonts text elements can use
+     * \retval expected<display_list, std::string> the display list or a description of the first invalid element
+     */
+    static expected<display_list, std::string> from_json(const json& description, const font_table& fonts);
+
+    /**
+     * \brief draw the layout on a canvas
+     *
+     * \param canvas the canvas to draw on
+     */
+    void execute(canvas& canvas) const;
+
+    // Get the commands of the list
+    const std::vector<display_command>& commands() const {
+        return m_commands;
+    }
+
+    // Get the span table at absolute positions
+    const std::vector<span>& spans() const {
+        return m_spans;
+    }
+
+  private:
+    // Append spans drawn in a color at an offset, extending the last command if it uses the same color
+    void add_spans(const pixel& color, const std::vector<span>& spans, int x, int y);
+
+    std::vector<display_command> m_commands;
+    std::vector<span> m_spans;
+};
+
+// Holds the active layout. Layouts are compiled away from the frame path and swapped in whole, so executing one on the
+// frame path only copies a reference. The replaced layout is kept until the next swap so the frame path never frees
+// the layout it is drawing unless layouts change faster than frames.
+class layout_switcher {
+  public:
+    /**
+     * \brief make a compiled layout the active one. Safe to call from any thread.
+     *
+     * \param layout the layout, or nullptr for none
+     */
+    void set(std::shared_ptr<const display_list> layout) {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        auto previous = std::atomic_exchange(&m_active, std::move(layout));
+        m_retired = std::move(previous);
+        m_generation.fetch_add(1, std::memory_order_release);
+    }
+
+    /**
+     * \brief draw the active layout
+     *
+     * \param canvas the canvas to draw on
+     * \retval bool false if there is no active layout
+     */
+    bool execute(canvas& canvas) const {
+        auto layout = std::atomic_load(&m_active);
+        if ( !layout ) {
+            return false;
+        }
+        layout->execute(canvas);
+        return true;
+    }
+
+    // Get the active layout, nullptr if there is none. Holding it keeps the layout alive across a switch.
+    std::shared_ptr<const display_list> current() const {
+        return std::atomic_load(&m_active);
+    }
+
+    // Get the number of times the layout has been switched
+    uint64_t generation() const {
+        return m_generation.load(std::memory_order_acquire);
+    }
+
+  private:
+    std::shared_ptr<const display_list> m_active;
+    std::shared_ptr<const display_list> m_retired;
+    std::mutex m_mutex;  // serializes swaps, the frame path never takes it
+    std::atomic<uint64_t> m_generation{0};
+};
+
+};  // namespace graphics
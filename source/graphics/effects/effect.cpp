@@ -0,0 +1,68 @@
+// RGB LED Matrix Graphics Library
+
+#include "effect.hpp"
+#include <algorithm>
+#include <chrono>
+
+namespace graphics
+{
+//-----------------------------------------------------------------------------
+effect::effect(const origin& origin, int width, int height)
+    : shape(origin)
+    , m_width(width)
+    , m_height(height)
+    , m_divisor(1)
+    , m_frame(width, height)
+    , m_time_ms(0)
+    , m_cost{} { }
+
+//-----------------------------------------------------------------------------
+const framebuffer& effect::render_frame() {
+    auto start = std::chrono::steady_clock::now();
+    render(m_frame, m_time_ms);
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    m_cost.last_us = static_cast<uint32_t>(elapsed);
+    m_cost.peak_us = std::max(m_cost.peak_us, m_cost.last_us);
+    m_cost.average_us = (m_cost.frames == 0)
+        ? m_cost.last_us
+        : static_cast<uint32_t>((static_cast<uint64_t>(m_cost.average_us) * 7 + m_cost.last_us) / 8);
+    m_cost.frames++;
+    return m_frame;
+}
+
+//-----------------------------------------------------------------------------
+void effect::set_resolution(unsigned divisor) {
+    divisor = std::clamp(divisor, 1u, 8u);
+    if ( divisor == m_divisor ) {
+        return;
+    }
+    m_divisor = divisor;
+    m_frame = framebuffer(static_cast<int>((m_width + divisor - 1) / divisor), static_cast<int>((m_height + divisor - 1) / divisor));
+    m_row.resize((divisor > 1) ? m_width : 0);
+    touch();
+}
+
+//-----------------------------------------------------------------------------
+void effect::draw(canvas& canvas) {
+    const auto& frame = render_frame();
+    if ( m_divisor == 1 ) {
+        for ( int y = 0; y < frame.height(); y++ ) {
+            canvas.blit_row(m_origin.x, m_origin.y + y, frame.row(y), frame.width());
+        }
+        return;
+    }
+
+    // scale up by repeating each rendered pixel across a divisor sized block
+    for ( int y = 0; y < m_height; y++ ) {
+        if ( (y % m_divisor) == 0 ) {
+            auto source = frame.row(static_cast<int>(y / m_divisor));
+            for ( int x = 0; x < m_width; x++ ) {
+                m_row[x] = source[x / m_divisor];
+            }
+        }
+        canvas.blit_row(m_origin.x, m_origin.y + y, m_row.data(), m_width);
+    }
+}
+
+};  // namespace graphics
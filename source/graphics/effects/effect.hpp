@@ -0,0 +1,103 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "framebuffer.hpp"
+#include "shape.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace graphics
+{
+
+// Render time of an effect in microseconds
+struct effect_cost {
+    uint32_t last_us;
+    uint32_t average_us;  // exponential moving average over roughly the last eight frames
+    uint32_t peak_us;
+    uint64_t frames;
+};
+
+// Base class for procedural effects. Effects render whole frames into their own framebuffer with row kernels,
+// which is then copied onto the canvas a row at a time. The render time of every frame is recorded so effects
+// can be budgeted against the frame rate.
+class effect : public shape {
+  public:
+    /**
+     * \brief Construct a new effect
+     *
+     * \param origin top-left corner of the effect
+     * \param width width of the effect in pixels
+     * \param height height of the effect in pixels
+     */
+    effect(const origin& origin, int width, int height);
+
+    // Render the effect at the current time and draw it on the canvas
+    void draw(canvas& canvas) override;
+
+    // Get the area covered by the effect
+    rect bounds() const override {
+        return rect{static_cast<int16_t>(m_origin.x), static_cast<int16_t>(m_origin.y), static_cast<uint16_t>(m_width), static_cast<uint16_t>(m_height)};
+    }
+
+    /**
+     * \brief render the effect at the current time into its frame without drawing it
+     *
+     * \retval const framebuffer& the rendered frame, reduced by the resolution divisor
+     */
+    const framebuffer& render_frame();
+
+    /**
+     * \brief render at a fraction of the effect's size and scale it up when drawing, cutting render cost by the
+     *        square of the divisor
+     *
+     * \param divisor 1 for full resolution, 2 for half, up to 8
+     */
+    void set_resolution(unsigned divisor);
+
+    // Get the resolution divisor
+    unsigned resolution() const {
+        return m_divisor;
+    }
+
+    // Move the effect's clock forward
+    void advance(uint32_t elapsed_ms) {
+        m_time_ms += elapsed_ms;
+        touch();
+    }
+
+    // Get the effect's clock
+    uint32_t time() const {
+        return m_time_ms;
+    }
+
+    // Get the render cost statistics
+    const effect_cost& cost() const {
+        return m_cost;
+    }
+
+    // Reset the render cost statistics
+    void reset_cost() {
+        m_cost = effect_cost{};
+    }
+
+  protected:
+    /**
+     * \brief render one frame of the effect
+     *
+     * \param frame frame to render into, sized to the effect
+     * \param time_ms the effect's clock
+     */
+    virtual void render(framebuffer& frame, uint32_t time_ms) = 0;
+
+  private:
+    int m_width;
+    int m_height;
+    unsigned m_divisor;
+    framebuffer m_frame;
+    std::vector<packed_pixel> m_row;  // row scaled up to full width when rendering at reduced resolution
+    uint32_t m_time_ms;
+    effect_cost m_cost;
+};
+
+};  // namespace graphics
@@ -0,0 +1,88 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "math_utilities.hpp"
+#include "pixel.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace graphics
+{
+
+// 256 entry color table indexed by an 8-bit value. Effects compute a palette index per pixel and look the
+// color up, so the per-pixel math stays in small integers.
+using palette = std::array<packed_pixel, 256>;
+
+// Color at a position in a palette gradient
+struct palette_stop {
+    uint8_t position;
+    pixel color;
+};
+
+/**
+ * \brief build a palette by linearly interpolating between stops. Stops must be sorted by position, starting at 0
+ *        and ending at 255.
+ *
+ * \param stops the gradient stops
+ * \retval constexpr palette
+ */
+template <std::size_t N>
+constexpr palette make_palette(const std::array<palette_stop, N>& stops) {
+    palette colors{};
+    std::size_t segment = 0;
+    for ( int i = 0; i < 256; i++ ) {
+        while ( (segment + 2 < N) && (i > stops[segment + 1].position) ) {
+            segment++;
+        }
+        const auto& from = stops[segment];
+        const auto& to = stops[segment + 1];
+        int span = to.position - from.position;
+        int weight = (span == 0) ? 0 : ((i - from.position) * 256) / span;
+        auto lerp = [weight](uint8_t a, uint8_t b) {
+            return static_cast<uint8_t>(a + (((b - a) * weight) >> 8));
+        };
+        colors[i] = pack(lerp(from.color.red, to.color.red), lerp(from.color.green, to.color.green), lerp(from.color.blue, to.color.blue));
+    }
+    return colors;
+}
+
+inline constexpr palette rainbow_palette = make_palette(std::array<palette_stop, 7>{{
+    {0, {255, 0, 0}}, {43, {255, 255, 0}}, {85, {0, 255, 0}}, {128, {0, 255, 255}},
+    {170, {0, 0, 255}}, {213, {255, 0, 255}}, {255, {255, 0, 0}}
+}});
+
+inline constexpr palette fire_palette = make_palette(std::array<palette_stop, 5>{{
+    {0, {0, 0, 0}}, {85, {192, 0, 0}}, {160, {255, 128, 0}}, {220, {255, 224, 32}}, {255, {255, 255, 192}}
+}});
+
+inline constexpr palette ocean_palette = make_palette(std::array<palette_stop, 4>{{
+    {0, {0, 0, 32}}, {96, {0, 64, 160}}, {192, {0, 192, 192}}, {255, {192, 255, 255}}
+}});
+
+// Sine of a full turn split into 256 steps, offset and scaled into [1, 255]
+constexpr std::array<uint8_t, 256> make_sin8_table() {
+    std::array<uint8_t, 256> table{};
+    for ( int i = 0; i < 256; i++ ) {
+        table[i] = static_cast<uint8_t>(128 + math_helpers::round(127 * math_helpers::sin(i * 2 * math_helpers::pi / 256)));
+    }
+    return table;
+}
+
+inline constexpr auto sin8_table = make_sin8_table();
+
+// Table lookup sine where an angle of 256 is a full turn
+constexpr uint8_t sin8(uint8_t angle) {
+    return sin8_table[angle];
+}
+
+// Fast pseudo random number generator for effects. Never returns zero for a non-zero state.
+constexpr uint32_t xorshift32(uint32_t state) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+};  // namespace graphics
@@ -0,0 +1,48 @@
+// RGB LED Matrix Graphics Library
+
+#include "fire.hpp"
+
+namespace graphics
+{
+//-----------------------------------------------------------------------------
+fire::fire(const origin& origin, int width, int height, const palette& colors, uint8_t cooling)
+    : effect(origin, width, height)
+    , m_palette(colors)
+    , m_cooling(cooling)
+    , m_stride(width + 2)
+    , m_heat(static_cast<std::size_t>(width + 2) * (height + 2), 0)
+    , m_seed(0x2545F491) { }
+
+//-----------------------------------------------------------------------------
+void fire::render(framebuffer& frame, uint32_t) {
+    auto width = frame.width();
+    auto height = frame.height();
+
+    // feed the two hidden rows with fresh random heat
+    for ( int y = height; y < height + 2; y++ ) {
+        auto row = heat_row(y);
+        for ( int x = 1; x <= width; x++ ) {
+            m_seed = xorshift32(m_seed);
+            row[x] = static_cast<uint8_t>(m_seed >> 24) | 0x40;
+        }
+    }
+
+    for ( int y = 0; y < height; y++ ) {
+        auto target = heat_row(y);
+        const auto below = heat_row(y + 1);
+        const auto two_below = heat_row(y + 2);
+
+        // the padding columns stay cold which keeps the flames off the edges
+        for ( int x = 1; x <= width; x++ ) {
+            auto average = static_cast<uint8_t>((below[x - 1] + below[x] + below[x + 1] + two_below[x]) >> 2);
+            target[x] = (average > m_cooling) ? static_cast<uint8_t>(average - m_cooling) : 0;
+        }
+
+        auto row = frame.row(y);
+        for ( int x = 0; x < width; x++ ) {
+            row[x] = m_palette[target[x + 1]];
+        }
+    }
+}
+
+};  // namespace graphics
@@ -0,0 +1,43 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "effect.hpp"
+#include "effect_tables.hpp"
+#include <vector>
+
+namespace graphics
+{
+
+// Classic rising fire. Random heat is fed into two hidden rows below the effect and every frame each cell takes the
+// average of the cells beneath it less some cooling. The heat field advances one step per rendered frame.
+class fire : public effect {
+  public:
+    /**
+     * \brief Construct a new fire effect
+     *
+     * \param origin top-left corner of the effect
+     * \param width width of the effect in pixels
+     * \param height height of the effect in pixels
+     * \param colors palette to map heat to colors
+     * \param cooling heat lost per row as flames rise. Larger values give shorter flames.
+     */
+    fire(const origin& origin, int width, int height, const palette& colors = fire_palette, uint8_t cooling = 12);
+
+  protected:
+    void render(framebuffer& frame, uint32_t time_ms) override;
+
+  private:
+    // Access a row of the heat field, including the padding column on each side
+    uint8_t* heat_row(int y) {
+        return m_heat.data() + static_cast<std::size_t>(y) * m_stride;
+    }
+
+    palette m_palette;
+    uint8_t m_cooling;
+    int m_stride;
+    std::vector<uint8_t> m_heat;
+    uint32_t m_seed;
+};
+
+};  // namespace graphics
@@ -0,0 +1,35 @@
+// RGB LED Matrix Graphics Library
+
+#include "gradient_sweep.hpp"
+
+namespace graphics
+{
+//-----------------------------------------------------------------------------
+gradient_sweep::gradient_sweep(const origin& origin, int width, int height, const palette& colors, uint16_t x_step, uint16_t y_step)
+    : effect(origin, width, height)
+    , m_palette(colors)
+    , m_x_step(x_step)
+    , m_y_step(y_step)
+    , m_offsets(width) {
+    for ( int x = 0; x < width; x++ ) {
+        m_offsets[x] = static_cast<uint16_t>(x * m_x_step);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void gradient_sweep::render(framebuffer& frame, uint32_t time_ms) {
+    // one palette entry every 8ms
+    auto phase = static_cast<uint16_t>(time_ms << 5);
+    auto width = frame.width();
+    auto offsets = m_offsets.data();
+
+    for ( int y = 0; y < frame.height(); y++ ) {
+        auto base = static_cast<uint16_t>(y * m_y_step + phase);
+        auto row = frame.row(y);
+        for ( int x = 0; x < width; x++ ) {
+            row[x] = m_palette[static_cast<uint16_t>(base + offsets[x]) >> 8];
+        }
+    }
+}
+
+};  // namespace graphics
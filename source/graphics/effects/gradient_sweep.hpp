@@ -0,0 +1,39 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "effect.hpp"
+#include "effect_tables.hpp"
+#include <vector>
+
+namespace graphics
+{
+
+// Palette gradient that scrolls across the effect. The gradient direction is set by how far the palette index
+// moves per pixel along each axis, in 8.8 fixed point.
+class gradient_sweep : public effect {
+  public:
+    /**
+     * \brief Construct a new gradient sweep effect
+     *
+     * \param origin top-left corner of the effect
+     * \param width width of the effect in pixels
+     * \param height height of the effect in pixels
+     * \param colors palette to sweep through
+     * \param x_step palette entries per column in 8.8 fixed point
+     * \param y_step palette entries per row in 8.8 fixed point
+     */
+    gradient_sweep(const origin& origin, int width, int height, const palette& colors = rainbow_palette, uint16_t x_step = 1024,
+                   uint16_t y_step = 512);
+
+  protected:
+    void render(framebuffer& frame, uint32_t time_ms) override;
+
+  private:
+    palette m_palette;
+    uint16_t m_x_step;
+    uint16_t m_y_step;
+    std::vector<uint16_t> m_offsets;
+};
+
+};  // namespace graphics
@@ -0,0 +1,49 @@
+// RGB LED Matrix Graphics Library
+
+#include "plasma.hpp"
+
+namespace graphics
+{
+//-----------------------------------------------------------------------------
+plasma::plasma(const origin& origin, int width, int height, const palette& colors, uint8_t scale)
+    : effect(origin, width, height)
+    , m_palette(colors)
+    , m_scale(scale)
+    , m_columns(width)
+    , m_diagonal(width + height)
+    , m_indices(width) { }
+
+//-----------------------------------------------------------------------------
+void plasma::render(framebuffer& frame, uint32_t time_ms) {
+    // each wave drifts at a different rate so the pattern never repeats exactly
+    auto column_phase = static_cast<uint8_t>(time_ms >> 4);
+    auto row_phase = static_cast<uint8_t>(time_ms >> 5);
+    auto diagonal_phase = static_cast<uint8_t>((time_ms * 3) >> 6);
+
+    auto width = frame.width();
+    for ( int x = 0; x < width; x++ ) {
+        m_columns[x] = sin8(static_cast<uint8_t>(x * m_scale + column_phase));
+    }
+    for ( std::size_t i = 0; i < m_diagonal.size(); i++ ) {
+        m_diagonal[i] = sin8(static_cast<uint8_t>((i * m_scale) / 2 - diagonal_phase));
+    }
+
+    auto columns = m_columns.data();
+    auto indices = m_indices.data();
+    for ( int y = 0; y < frame.height(); y++ ) {
+        auto row_term = sin8(static_cast<uint8_t>(y * m_scale - row_phase));
+        auto diagonal = m_diagonal.data() + y;
+
+        // average of the three waves, (a + b + c) * 85 / 256 ~= (a + b + c) / 3
+        for ( int x = 0; x < width; x++ ) {
+            indices[x] = static_cast<uint8_t>(((columns[x] + row_term + diagonal[x]) * 85) >> 8);
+        }
+
+        auto row = frame.row(y);
+        for ( int x = 0; x < width; x++ ) {
+            row[x] = m_palette[indices[x]];
+        }
+    }
+}
+
+};  // namespace graphics
@@ -0,0 +1,38 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "effect.hpp"
+#include "effect_tables.hpp"
+#include <vector>
+
+namespace graphics
+{
+
+// Plasma made of three moving sine waves: one across the columns, one down the rows and one along the diagonal.
+// The wave terms are looked up once per frame so each pixel costs two adds, a multiply and a palette lookup.
+class plasma : public effect {
+  public:
+    /**
+     * \brief Construct a new plasma effect
+     *
+     * \param origin top-left corner of the effect
+     * \param width width of the effect in pixels
+     * \param height height of the effect in pixels
+     * \param colors palette to color the plasma with
+     * \param scale angle step per pixel. Larger values give tighter waves.
+     */
+    plasma(const origin& origin, int width, int height, const palette& colors = rainbow_palette, uint8_t scale = 8);
+
+  protected:
+    void render(framebuffer& frame, uint32_t time_ms) override;
+
+  private:
+    palette m_palette;
+    uint8_t m_scale;
+    std::vector<uint8_t> m_columns;
+    std::vector<uint8_t> m_diagonal;
+    std::vector<uint8_t> m_indices;
+};
+
+};  // namespace graphics
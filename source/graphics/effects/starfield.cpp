@@ -0,0 +1,59 @@
+// RGB LED Matrix Graphics Library
+
+#include "starfield.hpp"
+#include <algorithm>
+
+namespace graphics
+{
+// Depth of the view volume
+constexpr int far_plane_depth = 1024;
+
+//-----------------------------------------------------------------------------
+starfield::starfield(const origin& origin, int width, int height, int star_count, uint16_t speed)
+    : effect(origin, width, height)
+    , m_stars(std::max(star_count, 0))
+    , m_speed(speed)
+    , m_last_time_ms(0)
+    , m_seed(0x9E3779B9) {
+    for ( auto& star : m_stars ) {
+        spawn(star, false);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void starfield::spawn(star& star, bool far_plane) {
+    m_seed = xorshift32(m_seed);
+    star.x = static_cast<int16_t>(static_cast<int>(m_seed & 0x7FF) - 1024);
+    star.y = static_cast<int16_t>(static_cast<int>((m_seed >> 11) & 0x7FF) - 1024);
+    star.z = static_cast<int16_t>(far_plane ? far_plane_depth : 1 + ((m_seed >> 22) % far_plane_depth));
+}
+
+//-----------------------------------------------------------------------------
+void starfield::render(framebuffer& frame, uint32_t time_ms) {
+    auto travelled = static_cast<int>(std::min<uint32_t>((time_ms - m_last_time_ms) * m_speed, far_plane_depth));
+    m_last_time_ms = time_ms;
+
+    std::fill(frame.data(), frame.data() + frame.size(), packed_pixel{0});
+    auto half_width = frame.width() / 2;
+    auto half_height = frame.height() / 2;
+
+    for ( auto& star : m_stars ) {
+        star.z = static_cast<int16_t>(star.z - travelled);
+        if ( star.z <= 0 ) {
+            spawn(star, true);
+        }
+
+        // a star at the far plane edge projects to the edge of the panel
+        auto x = half_width + (star.x * half_width) / star.z;
+        auto y = half_height + (star.y * half_height) / star.z;
+        if ( (x < 0) || (x >= frame.width()) || (y < 0) || (y >= frame.height()) ) {
+            spawn(star, true);
+            continue;
+        }
+
+        auto brightness = static_cast<uint8_t>(255 - ((star.z - 1) * 255) / far_plane_depth);
+        frame.row(y)[x] = pack(brightness, brightness, brightness);
+    }
+}
+
+};  // namespace graphics
@@ -0,0 +1,46 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "effect.hpp"
+#include "effect_tables.hpp"
+#include <vector>
+
+namespace graphics
+{
+
+// Stars flying towards the viewer. Star positions are integers in a view volume of +/-1024 across and 1 to 1024 deep,
+// projected with a single divide per star, so the cost depends on the star count rather than the panel size.
+class starfield : public effect {
+  public:
+    /**
+     * \brief Construct a new starfield effect
+     *
+     * \param origin top-left corner of the effect
+     * \param width width of the effect in pixels
+     * \param height height of the effect in pixels
+     * \param star_count number of stars
+     * \param speed depth units travelled per millisecond
+     */
+    starfield(const origin& origin, int width, int height, int star_count = 64, uint16_t speed = 1);
+
+  protected:
+    void render(framebuffer& frame, uint32_t time_ms) override;
+
+  private:
+    struct star {
+        int16_t x;
+        int16_t y;
+        int16_t z;
+    };
+
+    // Place a star at a random position, anywhere in the volume or at the far plane
+    void spawn(star& star, bool far_plane);
+
+    std::vector<star> m_stars;
+    uint16_t m_speed;
+    uint32_t m_last_time_ms;
+    uint32_t m_seed;
+};
+
+};  // namespace graphics
@@ -0,0 +1,44 @@
+// RGB LED Matrix Graphics Library
+
+#include "framebuffer.hpp"
+#include <algorithm>
+
+namespace graphics
+{
+//-----------------------------------------------------------------------------
+framebuffer::framebuffer(int width, int height)
+    : m_width(width)
+    , m_height(height)
+    , m_pixels(static_cast<std::size_t>(width) * height, 0) { }
+
+//-----------------------------------------------------------------------------
+void framebuffer::SetPixel(int x, int y, uint8_t red, uint8_t green, uint8_t blue) {
+    if ( (x >= 0) && (x < m_width) && (y >= 0) && (y < m_height) ) {
+        m_pixels[static_cast<std::size_t>(y) * m_width + x] = pack(red, green, blue);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void framebuffer::Clear() {
+    std::fill(m_pixels.begin(), m_pixels.end(), 0);
+}
+
+//-----------------------------------------------------------------------------
+void framebuffer::Fill(uint8_t red, uint8_t green, uint8_t blue) {
+    std::fill(m_pixels.begin(), m_pixels.end(), pack(red, green, blue));
+}
+
+//-----------------------------------------------------------------------------
+void framebuffer::copy_to(rgb_matrix::Canvas& target) const {
+    auto width = std::min(m_width, target.width());
+    auto height = std::min(m_height, target.height());
+    for ( int y = 0; y < height; y++ ) {
+        auto source = row(y);
+        for ( int x = 0; x < width; x++ ) {
+            auto color = source[x];
+            target.SetPixel(x, y, red_channel(color), green_channel(color), blue_channel(color));
+        }
+    }
+}
+
+};  // namespace graphics
@@ -0,0 +1,87 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "aligned_allocator.hpp"
+#include "canvas.h"
+#include "pixel.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace graphics
+{
+
+// Memory layout of an off-screen frame
+enum class framebuffer_layout { packed, planar };
+
+// Off-screen frame of packed 32-bit pixels stored row-major in aligned memory. Implements the driver
+// canvas interface so that shapes draw into it through graphics::canvas exactly as they would onto the panel.
+class framebuffer : public rgb_matrix::Canvas {
+  public:
+    using storage = std::vector<packed_pixel, aligned_allocator<packed_pixel>>;
+    static constexpr framebuffer_layout layout = framebuffer_layout::packed;
+
+    /**
+     * \brief Construct a new cleared framebuffer
+     *
+     * \param width width of the frame in pixels
+     * \param height height of the frame in pixels
+     */
+    framebuffer(int width, int height);
+
+    // rgb_matrix::Canvas interface
+    int width() const override {
+        return m_width;
+    }
+
+    int height() const override {
+        return m_height;
+    }
+
+    void SetPixel(int x, int y, uint8_t red, uint8_t green, uint8_t blue) override;
+    void Clear() override;
+    void Fill(uint8_t red, uint8_t green, uint8_t blue) override;
+
+    // Get a pixel from the frame. Coordinates must be inside the frame.
+    packed_pixel get_pixel(int x, int y) const {
+        return m_pixels[static_cast<std::size_t>(y) * m_width + x];
+    }
+
+    // Access a row of pixels
+    packed_pixel* row(int y) {
+        return m_pixels.data() + static_cast<std::size_t>(y) * m_width;
+    }
+
+    const packed_pixel* row(int y) const {
+        return m_pixels.data() + static_cast<std::size_t>(y) * m_width;
+    }
+
+    // Access the raw pixel data
+    packed_pixel* data() {
+        return m_pixels.data();
+    }
+
+    const packed_pixel* data() const {
+        return m_pixels.data();
+    }
+
+    // Number of pixels in the frame
+    std::size_t size() const {
+        return m_pixels.size();
+    }
+
+    /**
+     * \brief copy the frame on to a driver canvas, for example a FrameCanvas that is about to be swapped on to the panel
+     *
+     * \param target the canvas to copy to
+     */
+    void copy_to(rgb_matrix::Canvas& target) const;
+
+  private:
+    int m_width;
+    int m_height;
+    storage m_pixels;
+};
+
+};  // namespace graphics
@@ -0,0 +1,118 @@
+// RGB LED Matrix Graphics Library
+
+#include "kernels.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace graphics::kernels
+{
+// Masks to split a packed pixel into its red/blue and green lanes. Each lane has 8 bits of headroom so
+// the channels can be multiplied by a weight of up to 256 without carrying into their neighbours.
+constexpr uint32_t red_blue_mask = 0x00FF00FF;
+constexpr uint32_t green_mask = 0x0000FF00;
+
+// Map an 8-bit alpha onto 0 - 256 so that full opacity is an exact shift
+constexpr uint32_t expand_alpha(uint8_t alpha) {
+    return static_cast<uint32_t>(alpha) + (alpha >> 7);
+}
+
+//-----------------------------------------------------------------------------
+void to_planar(const framebuffer& source, planar_framebuffer& destination) {
+    auto count = std::min(source.size(), destination.size());
+    const packed_pixel* __restrict input = source.data();
+    uint8_t* __restrict red = destination.red_plane().data();
+    uint8_t* __restrict green = destination.green_plane().data();
+    uint8_t* __restrict blue = destination.blue_plane().data();
+    for ( std::size_t i = 0; i < count; i++ ) {
+        red[i] = red_channel(input[i]);
+        green[i] = green_channel(input[i]);
+        blue[i] = blue_channel(input[i]);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void to_packed(const planar_framebuffer& source, framebuffer& destination) {
+    auto count = std::min(source.size(), destination.size());
+    const uint8_t* __restrict red = source.red_plane().data();
+    const uint8_t* __restrict green = source.green_plane().data();
+    const uint8_t* __restrict blue = source.blue_plane().data();
+    packed_pixel* __restrict output = destination.data();
+    for ( std::size_t i = 0; i < count; i++ ) {
+        output[i] = pack(red[i], green[i], blue[i]);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void copy(framebuffer& destination, const framebuffer& source) {
+    auto count = std::min(source.size(), destination.size());
+    std::memcpy(destination.data(), source.data(), count * sizeof(packed_pixel));
+}
+
+//-----------------------------------------------------------------------------
+void blend(framebuffer& destination, const framebuffer& source, uint8_t alpha) {
+    auto count = std::min(source.size(), destination.size());
+    const packed_pixel* __restrict input = source.data();
+    packed_pixel* __restrict output = destination.data();
+    const uint32_t source_weight = expand_alpha(alpha);
+    const uint32_t destination_weight = 256 - source_weight;
+    for ( std::size_t i = 0; i < count; i++ ) {
+        auto red_blue = (input[i] & red_blue_mask) * source_weight + (output[i] & red_blue_mask) * destination_weight;
+        auto green = (input[i] & green_mask) * source_weight + (output[i] & green_mask) * destination_weight;
+        output[i] = ((red_blue >> 8) & red_blue_mask) | ((green >> 8) & green_mask);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void blend(uint8_t* destination, const uint8_t* source, std::size_t count, uint8_t alpha) {
+    const uint8_t* __restrict input = source;
+    uint8_t* __restrict output = destination;
+    const uint16_t source_weight = static_cast<uint16_t>(expand_alpha(alpha));
+    const uint16_t destination_weight = static_cast<uint16_t>(256 - source_weight);
+    for ( std::size_t i = 0; i < count; i++ ) {
+        output[i] = static_cast<uint8_t>((input[i] * source_weight + output[i] * destination_weight) >> 8);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void blend(planar_framebuffer& destination, const planar_framebuffer& source, uint8_t alpha) {
+    auto count = std::min(source.size(), destination.size());
+    blend(destination.red_plane().data(), source.red_plane().data(), count, alpha);
+    blend(destination.green_plane().data(), source.green_plane().data(), count, alpha);
+    blend(destination.blue_plane().data(), source.blue_plane().data(), count, alpha);
+}
+
+//-----------------------------------------------------------------------------
+void scale(framebuffer& frame, uint8_t factor) {
+    packed_pixel* __restrict pixels = frame.data();
+    const uint32_t weight = expand_alpha(factor);
+    for ( std::size_t i = 0; i < frame.size(); i++ ) {
+        auto red_blue = (pixels[i] & red_blue_mask) * weight;
+        auto green = (pixels[i] & green_mask) * weight;
+        pixels[i] = ((red_blue >> 8) & red_blue_mask) | ((green >> 8) & green_mask);
+    }
+}
+
+//-----------------------------------------------------------------------------
+channel_totals channel_sums(const framebuffer& frame) {
+    // red and blue accumulate side by side in the 16-bit halves of one word, which holds 257 full scale values
+    // before the blue lane would carry into red, so the lanes are flushed to the totals every 256 pixels
+    constexpr std::size_t block_size = 256;
+    const packed_pixel* __restrict pixels = frame.data();
+    channel_totals totals{0, 0, 0};
+
+    for ( std::size_t start = 0; start < frame.size(); start += block_size ) {
+        auto end = std::min(start + block_size, frame.size());
+        uint32_t red_blue = 0;
+        uint32_t green = 0;
+        for ( std::size_t i = start; i < end; i++ ) {
+            red_blue += pixels[i] & red_blue_mask;
+            green += (pixels[i] & green_mask) >> 8;
+        }
+        totals.red += red_blue >> 16;
+        totals.green += green;
+        totals.blue += red_blue & 0xFFFF;
+    }
+    return totals;
+}
+
+};  // namespace graphics::kernels
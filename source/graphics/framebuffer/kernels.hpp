@@ -0,0 +1,93 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "framebuffer.hpp"
+#include "planar_framebuffer.hpp"
+#include <cstddef>
+#include <cstdint>
+
+// Frame buffer kernels. Each kernel works on the layout that vectorizes best for it:
+//  - whole pixel operations (copy, scale, blend with a constant alpha) work on packed frames with the
+//    channels processed in parallel inside each 32-bit word
+//  - per-channel operations work on planar frames as flat byte arrays
+// All loops are written as straight-line array passes without branches so the compiler can vectorize them.
+namespace graphics::kernels
+{
+
+// Sum of each channel over a frame
+struct channel_totals {
+    uint64_t red;
+    uint64_t green;
+    uint64_t blue;
+};
+
+/**
+ * \brief convert a packed frame into a planar frame of the same dimensions
+ *
+ * \param source the packed frame
+ * \param destination the planar frame to write to
+ */
+void to_planar(const framebuffer& source, planar_framebuffer& destination);
+
+/**
+ * \brief convert a planar frame into a packed frame of the same dimensions
+ *
+ * \param source the planar frame
+ * \param destination the packed frame to write to
+ */
+void to_packed(const planar_framebuffer& source, framebuffer& destination);
+
+/**
+ * \brief copy one packed frame into another of the same dimensions
+ *
+ * \param destination the frame to copy to
+ * \param source the frame to copy from
+ */
+void copy(framebuffer& destination, const framebuffer& source);
+
+/**
+ * \brief blend a source frame over a destination frame with a constant alpha
+ *
+ * \param destination the frame to blend into
+ * \param source the frame to blend
+ * \param alpha opacity of the source frame, 0 (transparent) to 255 (opaque)
+ */
+void blend(framebuffer& destination, const framebuffer& source, uint8_t alpha);
+
+/**
+ * \brief blend a source frame over a destination frame with a constant alpha
+ *
+ * \param destination the frame to blend into
+ * \param source the frame to blend
+ * \param alpha opacity of the source frame, 0 (transparent) to 255 (opaque)
+ */
+void blend(planar_framebuffer& destination, const planar_framebuffer& source, uint8_t alpha);
+
+/**
+ * \brief blend two arrays of 8-bit channel values with a constant alpha
+ *
+ * \param destination the channel values to blend into
+ * \param source the channel values to blend
+ * \param count number of values
+ * \param alpha opacity of the source values
+ */
+void blend(uint8_t* destination, const uint8_t* source, std::size_t count, uint8_t alpha);
+
+/**
+ * \brief scale every channel of a frame by factor / 255
+ *
+ * \param frame the frame to scale
+ * \param factor the scale factor, 255 leaves the frame unchanged
+ */
+void scale(framebuffer& frame, uint8_t factor);
+
+/**
+ * \brief sum each channel over every pixel of a frame in a single pass
+ *
+ * \param frame the frame
+ * \retval channel_totals
+ */
+channel_totals channel_sums(const framebuffer& frame);
+
+};  // namespace graphics::kernels
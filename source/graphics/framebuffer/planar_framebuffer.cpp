@@ -0,0 +1,38 @@
+// RGB LED Matrix Graphics Library
+
+#include "planar_framebuffer.hpp"
+#include <algorithm>
+
+namespace graphics
+{
+//-----------------------------------------------------------------------------
+planar_framebuffer::planar_framebuffer(int width, int height)
+    : m_width(width)
+    , m_height(height)
+    , m_red(static_cast<std::size_t>(width) * height, 0)
+    , m_green(static_cast<std::size_t>(width) * height, 0)
+    , m_blue(static_cast<std::size_t>(width) * height, 0) { }
+
+//-----------------------------------------------------------------------------
+void planar_framebuffer::SetPixel(int x, int y, uint8_t red, uint8_t green, uint8_t blue) {
+    if ( (x >= 0) && (x < m_width) && (y >= 0) && (y < m_height) ) {
+        auto index = static_cast<std::size_t>(y) * m_width + x;
+        m_red[index] = red;
+        m_green[index] = green;
+        m_blue[index] = blue;
+    }
+}
+
+//-----------------------------------------------------------------------------
+void planar_framebuffer::Clear() {
+    Fill(0, 0, 0);
+}
+
+//-----------------------------------------------------------------------------
+void planar_framebuffer::Fill(uint8_t red, uint8_t green, uint8_t blue) {
+    std::fill(m_red.begin(), m_red.end(), red);
+    std::fill(m_green.begin(), m_green.end(), green);
+    std::fill(m_blue.begin(), m_blue.end(), blue);
+}
+
+};  // namespace graphics
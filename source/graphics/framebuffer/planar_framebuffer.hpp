@@ -0,0 +1,88 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "aligned_allocator.hpp"
+#include "canvas.h"
+#include "framebuffer.hpp"
+#include "pixel.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace graphics
+{
+
+// Off-screen frame stored as three separate 8-bit planes (red, green, blue). Per-channel kernels
+// such as blending run over each plane as a flat byte array, which keeps every vector lane busy.
+class planar_framebuffer : public rgb_matrix::Canvas {
+  public:
+    using plane = std::vector<uint8_t, aligned_allocator<uint8_t>>;
+    static constexpr framebuffer_layout layout = framebuffer_layout::planar;
+
+    /**
+     * \brief Construct a new cleared planar framebuffer
+     *
+     * \param width width of the frame in pixels
+     * \param height height of the frame in pixels
+     */
+    planar_framebuffer(int width, int height);
+
+    // rgb_matrix::Canvas interface
+    int width() const override {
+        return m_width;
+    }
+
+    int height() const override {
+        return m_height;
+    }
+
+    void SetPixel(int x, int y, uint8_t red, uint8_t green, uint8_t blue) override;
+    void Clear() override;
+    void Fill(uint8_t red, uint8_t green, uint8_t blue) override;
+
+    // Get a pixel from the frame. Coordinates must be inside the frame.
+    pixel get_pixel(int x, int y) const {
+        auto index = static_cast<std::size_t>(y) * m_width + x;
+        return pixel{m_red[index], m_green[index], m_blue[index]};
+    }
+
+    // Access the individual color planes
+    plane& red_plane() {
+        return m_red;
+    }
+
+    const plane& red_plane() const {
+        return m_red;
+    }
+
+    plane& green_plane() {
+        return m_green;
+    }
+
+    const plane& green_plane() const {
+        return m_green;
+    }
+
+    plane& blue_plane() {
+        return m_blue;
+    }
+
+    const plane& blue_plane() const {
+        return m_blue;
+    }
+
+    // Number of pixels in the frame
+    std::size_t size() const {
+        return m_red.size();
+    }
+
+  private:
+    int m_width;
+    int m_height;
+    plane m_red;
+    plane m_green;
+    plane m_blue;
+};
+
+};  // namespace graphics
@@ -5,13 +5,53 @@
 
 // Include all components of the library
 #include "alignment.hpp"
+#include "animator.hpp"
+#include "bar_chart.hpp"
 #include "canvas.hpp"
+#include "chart.hpp"
+#include "circle.hpp"
 #include "character.hpp"
+#include "color_correction.hpp"
 #include "config_parser.hpp"
+#include "display_list.hpp"
+#include "dithering.hpp"
+#include "easing.hpp"
+#include "effect.hpp"
+#include "effect_tables.hpp"
+#include "fire.hpp"
+#include "frame_budget.hpp"
 #include "font.hpp"
+#include "frame_hash.hpp"
+#include "frame_pipeline.hpp"
+#include "frame_presenter.hpp"
+#include "frame_snapshot.hpp"
+#include "framebuffer.hpp"
+#include "gradient_sweep.hpp"
+#include "kernels.hpp"
+#include "line.hpp"
 #include "matrix.hpp"
 #include "origin.hpp"
 #include "pixel.hpp"
+#include "pixel_remap.hpp"
+#include "planar_framebuffer.hpp"
+#include "plasma.hpp"
+#include "polygon.hpp"
+#include "power_limiter.hpp"
+#include "rect.hpp"
+#include "rectangle.hpp"
+#include "region.hpp"
+#include "region_display.hpp"
+#include "scene.hpp"
+#include "scene_node.hpp"
+#include "scene_playlist.hpp"
 #include "text_box.hpp"
 #include "shape.hpp"
+#include "span_shape.hpp"
+#include "sparkline.hpp"
+#include "sprite.hpp"
+#include "sprite_sheet.hpp"
+#include "starfield.hpp"
+#include "static_layer.hpp"
+#include "video_player.hpp"
+#include "video_reader.hpp"
 
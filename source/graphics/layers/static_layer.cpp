@@ -0,0 +1,82 @@
+// RGB LED Matrix Graphics Library
+
+#include "static_layer.hpp"
+#include <algorithm>
+
+namespace graphics
+{
+//-----------------------------------------------------------------------------
+static_layer::static_layer(const origin& origin, int width, int height, bool opaque)
+    : shape(origin)
+    , m_frame(width, height)
+    , m_mask(opaque ? 0 : static_cast<std::size_t>((width + 7) / 8) * height, 0)
+    , m_mask_stride((width + 7) / 8)
+    , m_coverage(height, coverage::full)
+    , m_opaque(opaque)
+    , m_stale(true)
+    , m_render_count(0) { }
+
+//-----------------------------------------------------------------------------
+void static_layer::add(std::shared_ptr<shape> shape) {
+    m_shapes.push_back(cached_shape{std::move(shape), 0});
+    m_stale = true;
+}
+
+//-----------------------------------------------------------------------------
+void static_layer::clear() {
+    m_shapes.clear();
+    m_stale = true;
+}
+
+//-----------------------------------------------------------------------------
+bool static_layer::is_stale() const {
+    return m_stale || std::any_of(m_shapes.begin(), m_shapes.end(), [](const auto& cached) {
+        return cached.item->revision() != cached.revision;
+    });
+}
+
+//-----------------------------------------------------------------------------
+void static_layer::render() {
+    m_frame.Clear();
+    canvas layer_canvas{&m_frame};
+    for ( auto& cached : m_shapes ) {
+        cached.item->draw(layer_canvas);
+        cached.revision = cached.item->revision();
+    }
+
+    if ( !m_opaque ) {
+        std::fill(m_mask.begin(), m_mask.end(), 0);
+        for ( int y = 0; y < m_frame.height(); y++ ) {
+            auto row = m_frame.row(y);
+            auto mask = m_mask.data() + static_cast<std::size_t>(y) * m_mask_stride;
+            int lit = 0;
+            for ( int x = 0; x < m_frame.width(); x++ ) {
+                if ( row[x] != 0 ) {
+                    mask[x >> 3] |= static_cast<uint8_t>(0x80 >> (x & 0x07));
+                    lit++;
+                }
+            }
+            m_coverage[y] = (lit == 0) ? coverage::empty : ((lit == m_frame.width()) ? coverage::full : coverage::partial);
+        }
+    }
+
+    m_stale = false;
+    m_render_count++;
+}
+
+//-----------------------------------------------------------------------------
+void static_layer::draw(canvas& canvas) {
+    if ( is_stale() ) {
+        render();
+    }
+
+    for ( int y = 0; y < m_frame.height(); y++ ) {
+        if ( m_coverage[y] == coverage::empty ) {
+            continue;
+        }
+        auto mask = (m_coverage[y] == coverage::full) ? nullptr : m_mask.data() + static_cast<std::size_t>(y) * m_mask_stride;
+        canvas.blit_row(m_origin.x, m_origin.y + y, m_frame.row(y), m_frame.width(), mask);
+    }
+}
+
+};  // namespace graphics
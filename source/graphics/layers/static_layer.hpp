@@ -0,0 +1,85 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "framebuffer.hpp"
+#include "shape.hpp"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace graphics
+{
+
+// Layer of shapes that rarely change, such as backgrounds, borders and labels. The shapes are rendered once into an
+// off-screen frame and every draw after that is a row by row block copy. The layer re-renders only when it is
+// invalidated or one of its shapes reports a new revision.
+//
+// Shapes are positioned relative to the layer's origin. Transparent layers treat black (unlit) pixels as empty so
+// whatever is underneath shows through; opaque layers copy every pixel.
+class static_layer : public shape {
+  public:
+    /**
+     * \brief Construct a new static layer
+     *
+     * \param origin top-left corner of the layer
+     * \param width width of the layer in pixels
+     * \param height height of the layer in pixels
+     * \param opaque copy every pixel of the layer, including unlit ones
+     */
+    static_layer(const origin& origin, int width, int height, bool opaque = false);
+
+    /**
+     * \brief add a shape to the layer. Shapes draw in the order they are added.
+     *
+     * \param shape the shape to cache
+     */
+    void add(std::shared_ptr<shape> shape);
+
+    // Remove all shapes from the layer
+    void clear();
+
+    // Force the layer to re-render on the next draw, for shapes whose inputs change without a new revision
+    void invalidate() {
+        m_stale = true;
+    }
+
+    // Check if the next draw will re-render the layer
+    bool is_stale() const;
+
+    // Draw the cached layer on the canvas, re-rendering it first if it is stale
+    void draw(canvas& canvas) override;
+
+    // Get the area covered by the layer
+    rect bounds() const override {
+        return rect{static_cast<int16_t>(m_origin.x), static_cast<int16_t>(m_origin.y), static_cast<uint16_t>(m_frame.width()), static_cast<uint16_t>(m_frame.height())};
+    }
+
+    // Get the number of times the layer has been rendered
+    uint64_t render_count() const {
+        return m_render_count;
+    }
+
+  private:
+    // Render the shapes into the cached frame
+    void render();
+
+    // How much of a row the layer covers. Empty rows are skipped and full rows are copied without the mask.
+    enum class coverage : uint8_t { empty, partial, full };
+
+    struct cached_shape {
+        std::shared_ptr<shape> item;
+        uint32_t revision;
+    };
+
+    framebuffer m_frame;
+    std::vector<uint8_t> m_mask;
+    int m_mask_stride;
+    std::vector<coverage> m_coverage;
+    bool m_opaque;
+    bool m_stale;
+    std::vector<cached_shape> m_shapes;
+    uint64_t m_render_count;
+};
+
+};  // namespace graphics
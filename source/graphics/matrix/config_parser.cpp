@@ -2,9 +2,13 @@
 
 #include "config_parser.hpp"
 #include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <iostream>
 #include <map>
+#include <sstream>
+#include <string>
+#include <type_traits>
 
 namespace graphics {
 
@@ -31,7 +35,15 @@ enum class options : unsigned {
     limit_refresh_rate,
     slowdown,
     daemonize,
-    font
+    font,
+    gamma,
+    white_balance,
+    dither_mode,
+    transform,
+    power,
+    frame_budget,
+    drop_privileges,
+    threads
 };
 
 
@@ -47,6 +59,28 @@ std::optional<ReturnType> get_value(const std::map<Key, ReturnType>& map, Key ke
 }
 
 
+// Read an optional number from a sub-object into a setting, which keeps its value when the field is missing. Integer
+// settings only accept integers. Returns an error naming the field if it has the wrong type or is out of range.
+template <typename Type>
+static std::string read_number(const json& config, const std::string& key, Type& setting, Type minimum, Type maximum) {
+    if ( !config.contains(key) ) {
+        return {};
+    }
+    const auto& value = config[key];
+    if ( std::is_integral_v<Type> ? !value.is_number_integer() : !value.is_number() ) {
+        return key + (std::is_integral_v<Type> ? " must be an integer" : " must be a number");
+    }
+    auto number = std::is_integral_v<Type> ? static_cast<double>(value.get<int64_t>()) : value.get<double>();
+    if ( (number < minimum) || (number > maximum) ) {
+        std::ostringstream range;
+        range << key << " must be from " << minimum << " to " << maximum;
+        return range.str();
+    }
+    setting = static_cast<Type>(number);
+    return {};
+}
+
+
 // Maps options struct to RGB led matrix library CLI arguments
 const std::map<std::string, options> flag_options = {{"hardware_mapping", options::hardware_mapping},
                                                      {"panel_type", options::panel_type},
@@ -69,10 +103,153 @@ const std::map<std::string, options> flag_options = {{"hardware_mapping", option
                                                      {"limit_refresh_rate", options::limit_refresh_rate},
                                                      {"slowdown", options::slowdown},
                                                      {"daemonize", options::daemonize},
-                                                     {"font", options::font}};
+                                                     {"font", options::font},
+                                                     {"gamma", options::gamma},
+                                                     {"white_balance", options::white_balance},
+                                                     {"dither_mode", options::dither_mode},
+                                                     {"transform", options::transform},
+                                                     {"power", options::power},
+                                                     {"frame_budget", options::frame_budget},
+                                                     {"drop_privileges", options::drop_privileges},
+                                                     {"threads", options::threads}};
 
 static const std::map<std::string, int> daemon_settings = {{"manual", -1}, {"on", 1}, {"off", 0}};
 
+static const std::map<std::string, dither_mode> dither_settings = {{"none", dither_mode::none},
+                                                                   {"ordered", dither_mode::ordered},
+                                                                   {"temporal", dither_mode::temporal}};
+
+static const std::map<std::string, scheduling_policy> scheduling_settings = {{"other", scheduling_policy::other},
+                                                                            {"fifo", scheduling_policy::fifo}};
+
+static const std::map<int, rotation> rotation_settings = {{0, rotation::none},
+                                                          {90, rotation::rotate_90},
+                                                          {180, rotation::rotate_180},
+                                                          {270, rotation::rotate_270}};
+
+static const std::map<std::string, mirror> mirror_settings = {{"none", mirror::none},
+                                                              {"horizontal", mirror::horizontal},
+                                                              {"vertical", mirror::vertical}};
+
+static const std::map<std::string, tiling> tiling_settings = {{"none", tiling::none},
+                                                              {"u_chain", tiling::u_chain},
+                                                              {"serpentine", tiling::serpentine}};
+
+
+// Parse the canvas transform sub-object
+static expected<remap_options, std::string> parse_transform(const json& config) {
+    remap_options transform;
+    if ( !config.is_object() ) {
+        return expected<remap_options, std::string>::error("transform must be an object");
+    }
+    if ( config.contains("rotation") ) {
+        if ( !config["rotation"].is_number_integer() ) {
+            return expected<remap_options, std::string>::error("transform rotation must be an integer");
+        }
+        transform.rotate = get_value(rotation_settings, config["rotation"].get<int>()).value_or(rotation::none);
+    }
+    if ( config.contains("mirror") ) {
+        if ( !config["mirror"].is_string() ) {
+            return expected<remap_options, std::string>::error("transform mirror must be a string");
+        }
+        transform.flip = get_value(mirror_settings, config["mirror"].get<std::string>()).value_or(mirror::none);
+    }
+    if ( config.contains("tiling") ) {
+        if ( !config["tiling"].is_string() ) {
+            return expected<remap_options, std::string>::error("transform tiling must be a string");
+        }
+        transform.tile = get_value(tiling_settings, config["tiling"].get<std::string>()).value_or(tiling::none);
+    }
+    auto error = read_number(config, "panel_columns", transform.panel_columns, 1, 256);
+    if ( !error.empty() ) {
+        return expected<remap_options, std::string>::error("transform " + error);
+    }
+    return expected<remap_options, std::string>::success(transform);
+}
+
+
+// Parse the power limiter sub-object
+static expected<power_settings, std::string> parse_power(const json& config) {
+    constexpr double max_ma = 100000.0;
+    power_settings power;
+    if ( !config.is_object() ) {
+        return expected<power_settings, std::string>::error("power must be an object");
+    }
+    for ( auto error : {read_number(config, "red_ma", power.red_ma, 0.0, max_ma), read_number(config, "green_ma", power.green_ma, 0.0, max_ma),
+                        read_number(config, "blue_ma", power.blue_ma, 0.0, max_ma), read_number(config, "idle_ma", power.idle_ma, 0.0, max_ma),
+                        read_number(config, "budget_ma", power.budget_ma, 0.0, max_ma)} ) {
+        if ( !error.empty() ) {
+            return expected<power_settings, std::string>::error("power " + error);
+        }
+    }
+
+    // the idle current can't be limited, so a budget it already uses up would leave nothing to show
+    if ( (power.budget_ma > 0) && (power.idle_ma >= power.budget_ma) ) {
+        return expected<power_settings, std::string>::error("power budget_ma must be more than idle_ma");
+    }
+    return expected<power_settings, std::string>::success(power);
+}
+
+
+// Parse the frame budget sub-object
+static expected<budget_settings, std::string> parse_budget(const json& config) {
+    budget_settings budget;
+    if ( !config.is_object() ) {
+        return expected<budget_settings, std::string>::error("frame_budget must be an object");
+    }
+    for ( auto error : {read_number<uint32_t>(config, "budget_us", budget.budget_us, 0, 1000000),
+                        read_number<uint32_t>(config, "overrun_frames", budget.overrun_frames, 1, 10000),
+                        read_number<uint32_t>(config, "headroom_frames", budget.headroom_frames, 1, 100000),
+                        read_number<uint32_t>(config, "headroom_percent", budget.headroom_percent, 1, 100)} ) {
+        if ( !error.empty() ) {
+            return expected<budget_settings, std::string>::error("frame_budget " + error);
+        }
+    }
+    return expected<budget_settings, std::string>::success(budget);
+}
+
+
+// Parse the policy of one thread role
+static thread_policy parse_thread_policy(const json& config) {
+    thread_policy policy;
+    if ( !config.is_object() ) {
+        return policy;
+    }
+    if ( config.contains("cores") && config["cores"].is_array() ) {
+        for ( const auto& core : config["cores"] ) {
+            if ( core.is_number_integer() ) {
+                policy.cores.push_back(core.get<int>());
+            }
+        }
+    }
+    if ( config.contains("policy") && config["policy"].is_string() ) {
+        policy.policy = get_value(scheduling_settings, config["policy"].get<std::string>()).value_or(scheduling_policy::other);
+    }
+    if ( config.contains("priority") && config["priority"].is_number_integer() ) {
+        policy.priority = static_cast<int>(std::clamp<int64_t>(config["priority"].get<int64_t>(), 1, 99));
+    }
+    if ( config.contains("nice") && config["nice"].is_number_integer() ) {
+        policy.nice = static_cast<int>(std::clamp<int64_t>(config["nice"].get<int64_t>(), -20, 19));
+    }
+    return policy;
+}
+
+
+// Parse the thread roles sub-object
+thread_settings parse_thread_settings(const json& config) {
+    thread_settings threads;
+    if ( config.contains("render") ) {
+        threads.render = parse_thread_policy(config["render"]);
+    }
+    if ( config.contains("io") ) {
+        threads.io = parse_thread_policy(config["io"]);
+    }
+    if ( config.contains("tasks") ) {
+        threads.tasks = parse_thread_policy(config["tasks"]);
+    }
+    return threads;
+}
+
 
 // Copy construct configuration options - requires deep copying some items
 configuration_options::configuration_options(const configuration_options& other) {
@@ -191,12 +368,87 @@ expected<configuration_options, std::string> create_options_from_json(json& conf
                     options.app_options.font = std::string{value};
                     break;
 
+                case options::gamma: {
+                    // either a single gamma for all channels or an [r, g, b] triple. The LUT raises to the power of the
+                    // gamma, so it must be positive to keep every entry within 0 to 255.
+                    auto is_gamma = [](const json& item) { return item.is_number() && (item.get<double>() > 0.0) && (item.get<double>() <= 10.0); };
+                    if ( value.is_array() && (value.size() == 3) && std::all_of(value.begin(), value.end(), is_gamma) ) {
+                        options.app_options.color.red_gamma = value[0].get<double>();
+                        options.app_options.color.green_gamma = value[1].get<double>();
+                        options.app_options.color.blue_gamma = value[2].get<double>();
+                    } else if ( is_gamma(value) ) {
+                        options.app_options.color.red_gamma = value.get<double>();
+                        options.app_options.color.green_gamma = value.get<double>();
+                        options.app_options.color.blue_gamma = value.get<double>();
+                    } else {
+                        return expected<configuration_options, std::string>::error("gamma must be a number over 0 and up to 10, or three of them");
+                    }
+                    break;
+                }
+
+                case options::white_balance: {
+                    auto is_channel = [](const json& item) { return item.is_number_integer() && (item.get<int64_t>() >= 0) && (item.get<int64_t>() <= 255); };
+                    if ( !value.is_array() || (value.size() != 3) || !std::all_of(value.begin(), value.end(), is_channel) ) {
+                        return expected<configuration_options, std::string>::error("white_balance must be three integers from 0 to 255");
+                    }
+                    options.app_options.color.white_balance = pixel{value[0].get<uint8_t>(), value[1].get<uint8_t>(), value[2].get<uint8_t>()};
+                    break;
+                }
+
+                case options::dither_mode: {
+                    // unknown modes keep the default in application_options rather than picking a second default here
+                    if ( value.is_string() ) {
+                        options.app_options.dither = get_value(dither_settings, value.get<std::string>()).value_or(options.app_options.dither);
+                    }
+                    break;
+                }
+
+                case options::transform: {
+                    auto transform = parse_transform(value);
+                    if ( !transform ) {
+                        return expected<configuration_options, std::string>::error(transform.get_error());
+                    }
+                    options.app_options.transform = transform.get_value();
+                    break;
+                }
+
+                case options::power: {
+                    auto power = parse_power(value);
+                    if ( !power ) {
+                        return expected<configuration_options, std::string>::error(power.get_error());
+                    }
+                    options.app_options.power = power.get_value();
+                    break;
+                }
+
+                case options::frame_budget: {
+                    auto budget = parse_budget(value);
+                    if ( !budget ) {
+                        return expected<configuration_options, std::string>::error(budget.get_error());
+                    }
+                    options.app_options.budget = budget.get_value();
+                    break;
+                }
+
+                case options::drop_privileges:
+                    options.runtime_options.drop_privileges = bool{value} ? 1 : 0;
+                    break;
+
+                case options::threads:
+                    options.app_options.threads = parse_thread_settings(value);
+                    break;
+
                 default:
                     break;
             }
         }
     }
 
+    // the transform works in whole panels, which are only known once all of the options are parsed
+    options.app_options.transform.panel_width = options.options.cols;
+    options.app_options.transform.panel_height = options.options.rows;
+    options.app_options.power.hardware_brightness = options.options.brightness;
+
     std::string validation_results;
     if ( options.options.Validate(&validation_results) ) {
         return expected<configuration_options, std::string>::success(options);
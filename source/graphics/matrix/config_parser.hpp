@@ -2,9 +2,14 @@
 
 #pragma once
 
+#include "color_correction.hpp"
+#include "dithering.hpp"
 #include "expected.hpp"
+#include "frame_budget.hpp"
 #include "led-matrix.h"
 #include "nlohmann/json.hpp"
+#include "pixel_remap.hpp"
+#include "power_limiter.hpp"
 #include <memory>
 #include <string>
 #include <vector>
@@ -23,11 +28,41 @@ struct matrix_string_options {
     std::string pixel_mapper_config;
 };
 
+/**
+ * \brief scheduling policies for application threads
+ */
+enum class scheduling_policy { other, fifo };
+
+/**
+ * \brief where and how one application thread runs
+ */
+struct thread_policy {
+    std::vector<int> cores;                          // cores the thread may run on, empty for any core
+    scheduling_policy policy = scheduling_policy::other;
+    int priority = 0;                                // real-time priority from 1 to 99, used with the fifo policy
+    int nice = 0;                                    // nice value from -20 to 19, used with the other policy
+};
+
+/**
+ * \brief policies for each role of application thread. Keep these off the core the matrix refresh thread runs on.
+ */
+struct thread_settings {
+    thread_policy render;  // the frame loop
+    thread_policy io;      // the TCP service
+    thread_policy tasks;   // background workers: the render pool, video decoding and playlist preparation
+};
+
 /**
  * \brief custom application options that don't deal with the LED matrix settings 
  */
 struct application_options {
     std::string font;
+    color_settings color;
+    dither_mode dither = dither_mode::ordered;  // also used when dither_mode names an unknown mode
+    remap_options transform;
+    power_settings power;
+    budget_settings budget;
+    thread_settings threads;
 };
 
 /**
@@ -64,4 +99,12 @@ struct configuration_options {
  */
 expected<configuration_options, std::string> create_options_from_json(json& config);
 
+/**
+ * \brief parse the thread roles section of the configuration. Also used to try out new settings at runtime.
+ * 
+ * \param config the json object with a policy for each thread_settings role: render, io and tasks
+ * \retval thread_settings the policies, defaults for roles that are missing and for fields of the wrong type
+ */
+thread_settings parse_thread_settings(const json& config);
+
 };
\ No newline at end of file
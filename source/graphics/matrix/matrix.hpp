@@ -6,7 +6,9 @@
 #include "config_parser.hpp"
 #include "led-matrix.h"
 #include "canvas.hpp"
+#include "framebuffer.hpp"
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <fstream>
 
@@ -22,14 +24,29 @@ class matrix
     public:
     // Create the matrix from config data
     matrix(configuration_options& options)
-        : m_matrix(rgb_matrix::CreateMatrixFromOptions(options.options, options.runtime_options)) {}
+        : m_matrix(rgb_matrix::CreateMatrixFromOptions(options.options, options.runtime_options))
+        , m_offscreen(nullptr)
+        , m_options(options) {
+        // the driver returns nothing when it can't map the GPIO, usually for a wrong hardware_mapping or without root
+        if ( !m_matrix ) {
+            throw std::runtime_error("Could not create the LED matrix, check hardware_mapping and run as root");
+        }
+
+        // gamma is applied in software by the color correction stage, so the driver's CIE1931 curve would darken
+        // mid-tones a second time. Turn it off before creating the off-screen buffer, which copies the setting.
+        m_matrix->set_luminance_correct(false);
+        m_offscreen = m_matrix->CreateFrameCanvas();
+    }
 
     // Create with path to config data
     static matrix from_config(const std::string& config_path) {
         // Open the json configuration file and parse it
         json config = json::parse(std::ifstream{config_path});    
-        auto options = graphics::create_options_from_json(config).get_value();
-        return matrix(options);
+        auto options = graphics::create_options_from_json(config);
+        if ( !options ) {
+            throw std::runtime_error("Invalid configuration in " + config_path + ": " + options.get_error());
+        }
+        return matrix(options.get_value());
     }
 
     // Start drawing
@@ -42,8 +59,41 @@ class matrix
         return canvas(m_matrix.get());
     }
 
+    // Get the panel width
+    int width() const {
+        return m_matrix->width();
+    }
+
+    // Get the panel height
+    int height() const {
+        return m_matrix->height();
+    }
+
+    // Upload a completed frame to the off-screen buffer and swap it on to the panel at the next vsync
+    void present(const framebuffer& frame) {
+        upload(frame);
+        swap();
+    }
+
+    // Upload a completed frame to the off-screen buffer without showing it
+    void upload(const framebuffer& frame) {
+        frame.copy_to(*m_offscreen);
+    }
+
+    // Swap the off-screen buffer on to the panel. Blocks until the next vsync.
+    void swap() {
+        m_offscreen = m_matrix->SwapOnVSync(m_offscreen);
+    }
+
+    // Get the options the matrix was created with
+    const configuration_options& options() const {
+        return m_options;
+    }
+
 private:
     std::unique_ptr<rgb_matrix::RGBMatrix> m_matrix;
+    rgb_matrix::FrameCanvas* m_offscreen;  // owned by the matrix
+    configuration_options m_options;
 
 };
 
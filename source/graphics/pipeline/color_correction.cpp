@@ -0,0 +1,46 @@
+// RGB LED Matrix Graphics Library
+
+#include "color_correction.hpp"
+
+namespace graphics
+{
+//-----------------------------------------------------------------------------
+color_correction::color_correction()
+    : m_settings()
+    , m_luts(default_color_luts) { }
+
+//-----------------------------------------------------------------------------
+color_correction::color_correction(const color_settings& settings)
+    : m_settings(settings)
+    , m_luts((settings == color_settings{}) ? default_color_luts : make_color_luts(settings)) { }
+
+//-----------------------------------------------------------------------------
+void color_correction::set_settings(const color_settings& settings) {
+    if ( settings != m_settings ) {
+        m_settings = settings;
+        m_luts = make_color_luts(settings);
+        touch();
+    }
+}
+
+//-----------------------------------------------------------------------------
+void color_correction::set_brightness(uint8_t brightness) {
+    auto settings = m_settings;
+    settings.brightness = brightness;
+    set_settings(settings);
+}
+
+//-----------------------------------------------------------------------------
+void color_correction::process(framebuffer& frame) {
+    // single pass over the frame: three L1-resident table lookups per pixel
+    const uint8_t* __restrict red = m_luts.red.data();
+    const uint8_t* __restrict green = m_luts.green.data();
+    const uint8_t* __restrict blue = m_luts.blue.data();
+    packed_pixel* __restrict pixels = frame.data();
+    for ( std::size_t i = 0; i < frame.size(); i++ ) {
+        auto color = pixels[i];
+        pixels[i] = pack(red[red_channel(color)], green[green_channel(color)], blue[blue_channel(color)]);
+    }
+}
+
+};  // namespace graphics
@@ -0,0 +1,123 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "frame_stage.hpp"
+#include "math_utilities.hpp"
+#include "pixel.hpp"
+#include <array>
+#include <cstdint>
+
+namespace graphics
+{
+
+// Color correction settings applied by the color correction stage. The gamma curve replaces the driver's CIE1931
+// luminance correction, which graphics::matrix turns off.
+struct color_settings {
+    double red_gamma = 2.2;                   // gamma curve exponent per channel, more than 0
+    double green_gamma = 2.2;
+    double blue_gamma = 2.2;
+    pixel white_balance{255, 255, 255};       // per channel gain, 255 is unity
+    uint8_t brightness = 255;                 // global software brightness, 255 is unity
+};
+
+constexpr bool operator==(const color_settings& lhs, const color_settings& rhs) {
+    return (lhs.red_gamma == rhs.red_gamma) && (lhs.green_gamma == rhs.green_gamma) && (lhs.blue_gamma == rhs.blue_gamma) &&
+           (lhs.white_balance == rhs.white_balance) && (lhs.brightness == rhs.brightness);
+}
+
+constexpr bool operator!=(const color_settings& lhs, const color_settings& rhs) {
+    return !(lhs == rhs);
+}
+
+// Lookup table mapping an input channel value to its corrected output value
+using channel_lut = std::array<uint8_t, 256>;
+
+// Lookup tables for all three channels
+struct color_luts {
+    channel_lut red;
+    channel_lut green;
+    channel_lut blue;
+};
+
+/**
+ * \brief generate a lookup table for a single channel. Usable at compile time.
+ *
+ * \param gamma gamma curve exponent, which must be more than 0 to keep entries within 0 to 255
+ * \param gain white balance gain, 255 is unity
+ * \param brightness brightness, 255 is unity
+ * \retval channel_lut
+ */
+constexpr channel_lut make_channel_lut(double gamma, uint8_t gain, uint8_t brightness) {
+    channel_lut lut{};
+    const double scale = (gain / 255.0) * (brightness / 255.0);
+    for ( int i = 0; i < 256; i++ ) {
+        lut[i] = static_cast<uint8_t>(math_helpers::round(255.0 * math_helpers::pow(i / 255.0, gamma) * scale));
+    }
+    return lut;
+}
+
+/**
+ * \brief generate the lookup tables for a set of color settings. Usable at compile time.
+ *
+ * \param settings the color settings
+ * \retval color_luts
+ */
+constexpr color_luts make_color_luts(const color_settings& settings) {
+    return color_luts{make_channel_lut(settings.red_gamma, settings.white_balance.red, settings.brightness),
+                      make_channel_lut(settings.green_gamma, settings.white_balance.green, settings.brightness),
+                      make_channel_lut(settings.blue_gamma, settings.white_balance.blue, settings.brightness)};
+}
+
+// Tables for the default settings, generated at compile time
+inline constexpr color_luts default_color_luts = make_color_luts(color_settings{});
+
+// Frame stage that applies gamma, white balance and brightness to every pixel through per-channel lookup tables.
+// Tables are only rebuilt when the settings actually change.
+class color_correction : public frame_stage {
+  public:
+    /**
+     * \brief Construct a new color correction stage with the default settings
+     */
+    color_correction();
+
+    /**
+     * \brief Construct a new color correction stage
+     *
+     * \param settings the color settings to apply
+     */
+    explicit color_correction(const color_settings& settings);
+
+    /**
+     * \brief Update the color settings. The lookup tables are rebuilt if the settings differ from the current ones.
+     *
+     * \param settings the new settings
+     */
+    void set_settings(const color_settings& settings);
+
+    /**
+     * \brief Update only the brightness
+     *
+     * \param brightness the new brightness, 255 is unity
+     */
+    void set_brightness(uint8_t brightness);
+
+    // Get the current settings
+    const color_settings& settings() const {
+        return m_settings;
+    }
+
+    // Get the current lookup tables
+    const color_luts& luts() const {
+        return m_luts;
+    }
+
+    // frame_stage interface
+    void process(framebuffer& frame) override;
+
+  private:
+    color_settings m_settings;
+    color_luts m_luts;
+};
+
+};  // namespace graphics
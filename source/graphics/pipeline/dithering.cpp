@@ -0,0 +1,88 @@
+// RGB LED Matrix Graphics Library
+
+#include "dithering.hpp"
+#include <algorithm>
+
+namespace graphics
+{
+// Pattern offsets for each temporal slot. The most significant bits of a Bayer value come from the lowest
+// coordinate bits, so shifting by one pixel in x and/or y walks each pixel through the quarters of the threshold range.
+constexpr std::array<std::pair<unsigned, unsigned>, temporal_slots> slot_offsets = {{{0, 0}, {1, 1}, {1, 0}, {0, 1}}};
+
+//-----------------------------------------------------------------------------
+dithering::dithering(int width, int pwm_bits, dither_mode mode)
+    : m_width(width)
+    , m_levels((1u << std::clamp(pwm_bits, 1, 8)) - 1)
+    , m_mode(mode)
+    , m_slot(0)
+    , m_expand() {
+    for ( unsigned level = 0; level <= m_levels; level++ ) {
+        m_expand[level] = static_cast<uint8_t>((level * 255) / m_levels);
+    }
+    build_thresholds();
+}
+
+//-----------------------------------------------------------------------------
+void dithering::set_mode(dither_mode mode) {
+    if ( mode == m_mode ) {
+        return;
+    }
+    m_mode = mode;
+    m_slot = 0;
+    build_thresholds();
+    touch();
+}
+
+//-----------------------------------------------------------------------------
+void dithering::build_thresholds() {
+    const unsigned slots = (m_mode == dither_mode::temporal) ? temporal_slots : 1;
+    const unsigned cells = bayer_size * bayer_size;
+    m_thresholds.resize(static_cast<std::size_t>(slots) * bayer_size * m_width);
+
+    for ( unsigned slot = 0; slot < slots; slot++ ) {
+        auto [x_offset, y_offset] = slot_offsets[slot];
+        for ( unsigned row = 0; row < bayer_size; row++ ) {
+            auto thresholds = m_thresholds.data() + (static_cast<std::size_t>(slot) * bayer_size + row) * m_width;
+            for ( int x = 0; x < m_width; x++ ) {
+                if ( m_mode == dither_mode::none ) {
+                    // round to the nearest level
+                    thresholds[x] = 127;
+                } else {
+                    // centre each threshold in its bin across [0, 255)
+                    auto cell = bayer_value((x + x_offset) % bayer_size, (row + y_offset) % bayer_size);
+                    thresholds[x] = static_cast<uint8_t>(((2 * cell + 1) * 255) / (2 * cells));
+                }
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+void dithering::process(framebuffer& frame) {
+    // full colour depth is available, so there is nothing to dither
+    if ( m_levels == 255 ) {
+        return;
+    }
+
+    const unsigned slots = (m_mode == dither_mode::temporal) ? temporal_slots : 1;
+    const auto width = std::min(m_width, frame.width());
+    const uint32_t levels = m_levels;
+    const uint8_t* __restrict expand = m_expand.data();
+
+    for ( int y = 0; y < frame.height(); y++ ) {
+        const uint8_t* __restrict thresholds = m_thresholds.data() + (static_cast<std::size_t>(m_slot) * bayer_size + (y % bayer_size)) * m_width;
+        packed_pixel* __restrict pixels = frame.row(y);
+        for ( int x = 0; x < width; x++ ) {
+            auto color = pixels[x];
+            uint32_t threshold = thresholds[x];
+            auto red = (red_channel(color) * levels + threshold) / 255;
+            auto green = (green_channel(color) * levels + threshold) / 255;
+            auto blue = (blue_channel(color) * levels + threshold) / 255;
+            pixels[x] = pack(expand[red], expand[green], expand[blue]);
+        }
+    }
+
+    m_slot = (m_slot + 1) % slots;
+}
+
+};  // namespace graphics
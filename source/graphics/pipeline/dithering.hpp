@@ -0,0 +1,95 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "frame_stage.hpp"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace graphics
+{
+
+// Dithering modes supported by the dithering stage
+enum class dither_mode {
+    none,      // plain quantization to the panel bit depth
+    ordered,   // static 8x8 Bayer pattern
+    temporal   // Bayer pattern shifted every frame so each pixel cycles through its thresholds over time
+};
+
+// Size of the Bayer matrix used for ordered dithering
+constexpr unsigned bayer_size = 8;
+
+// Number of frame slots the temporal pattern cycles through
+constexpr unsigned temporal_slots = 4;
+
+/**
+ * \brief value of the Bayer matrix at a coordinate, from 0 to bayer_size * bayer_size - 1. Usable at compile time.
+ *
+ * \param x column within the matrix
+ * \param y row within the matrix
+ * \retval uint8_t
+ */
+constexpr uint8_t bayer_value(unsigned x, unsigned y) {
+    unsigned value = 0;
+    unsigned column = x ^ y;
+    for ( unsigned bit = 0; (1u << bit) < bayer_size; bit++ ) {
+        value = (value << 2) | (((column >> bit) & 0x01) << 1) | ((y >> bit) & 0x01);
+    }
+    return static_cast<uint8_t>(value);
+}
+
+// Frame stage that quantizes full 8-bit color down to the panel's PWM bit depth using ordered or temporal
+// dithering. Rendering stays in 8-bit color and the perceived depth is recovered spatially and over time. The output
+// levels land on PWM steps only because graphics::matrix turns the driver's luminance correction off; with it on the
+// driver would remap every level through its own curve afterwards.
+class dithering : public frame_stage {
+  public:
+    /**
+     * \brief Construct a new dithering stage
+     *
+     * \param width width of the frames in pixels
+     * \param pwm_bits number of PWM bits the panel is driven with (see create_options_from_json)
+     * \param mode the dithering mode
+     */
+    dithering(int width, int pwm_bits, dither_mode mode);
+
+    /**
+     * \brief change the dithering mode, for example to shed the per-frame cost of temporal dithering under load
+     *
+     * \param mode the new mode
+     */
+    void set_mode(dither_mode mode);
+
+    // Get the dithering mode
+    dither_mode mode() const {
+        return m_mode;
+    }
+
+    // Number of output levels per channel minus one
+    unsigned levels() const {
+        return m_levels;
+    }
+
+    // frame_stage interface
+    void process(framebuffer& frame) override;
+
+    bool is_temporal() const override {
+        return m_mode == dither_mode::temporal;
+    }
+
+  private:
+    /**
+     * \brief precompute a full width threshold row for every pattern row of every frame slot
+     */
+    void build_thresholds();
+
+    int m_width;
+    unsigned m_levels;
+    dither_mode m_mode;
+    unsigned m_slot;
+    std::vector<uint8_t> m_thresholds;    // [slot][pattern row][column]
+    std::array<uint8_t, 256> m_expand;    // quantized level back to 8-bit output
+};
+
+};  // namespace graphics
@@ -0,0 +1,114 @@
+// RGB LED Matrix Graphics Library
+
+#include "frame_budget.hpp"
+#include <algorithm>
+
+namespace graphics
+{
+//-----------------------------------------------------------------------------
+frame_budget::frame_budget(const budget_settings& settings)
+    : m_settings(settings)
+    , m_frame_us{}
+    , m_level(0)
+    , m_over_run(0)
+    , m_headroom_run(0)
+    , m_level_frames(1, 0)
+    , m_stats{} { }
+
+//-----------------------------------------------------------------------------
+std::size_t frame_budget::add_knob(quality_knob knob) {
+    knob.levels = std::max(knob.levels, 1u);
+    if ( knob.set ) {
+        knob.set(0);
+    }
+    m_knobs.push_back(knob_state{std::move(knob), 0, {}});
+    m_knobs.back().frames.resize(m_knobs.back().knob.levels, 0);
+    m_level_frames.resize(max_level() + 1, 0);
+    return m_knobs.size() - 1;
+}
+
+//-----------------------------------------------------------------------------
+unsigned frame_budget::max_level() const {
+    unsigned steps = 0;
+    for ( const auto& item : m_knobs ) {
+        steps += item.knob.levels - 1;
+    }
+    return steps;
+}
+
+//-----------------------------------------------------------------------------
+unsigned frame_budget::knob_level(std::size_t knob) const {
+    return m_knobs[knob].level;
+}
+
+//-----------------------------------------------------------------------------
+void frame_budget::add(frame_phase phase, std::chrono::microseconds elapsed) {
+    m_frame_us[static_cast<std::size_t>(phase)] += static_cast<uint32_t>(std::max<int64_t>(elapsed.count(), 0));
+}
+
+//-----------------------------------------------------------------------------
+bool frame_budget::end_frame() {
+    uint32_t total = 0;
+    for ( std::size_t i = 0; i < frame_phase_count; i++ ) {
+        auto& cost = m_stats.phases[i];
+        cost.last_us = m_frame_us[i];
+        cost.peak_us = std::max(cost.peak_us, cost.last_us);
+        cost.average_us = (m_stats.frames == 0)
+            ? cost.last_us
+            : static_cast<uint32_t>((static_cast<uint64_t>(cost.average_us) * 7 + cost.last_us) / 8);
+        total += m_frame_us[i];
+    }
+    m_frame_us.fill(0);
+
+    m_stats.frames++;
+    m_level_frames[m_level]++;
+    for ( auto& item : m_knobs ) {
+        item.frames[item.level]++;
+    }
+    if ( m_settings.budget_us == 0 ) {
+        return false;
+    }
+
+    // a single slow frame is a stutter nothing can prevent after the fact; only a run of them says the load has changed
+    if ( total > m_settings.budget_us ) {
+        m_stats.overruns++;
+        m_over_run++;
+        m_headroom_run = 0;
+    } else {
+        m_over_run = 0;
+        auto headroom = static_cast<uint64_t>(m_settings.budget_us) * m_settings.headroom_percent / 100;
+        m_headroom_run = (total < headroom) ? m_headroom_run + 1 : 0;
+    }
+
+    if ( (m_over_run >= m_settings.overrun_frames) && (m_level < max_level()) ) {
+        apply(m_level + 1);
+        m_stats.step_downs++;
+        m_over_run = 0;
+        return true;
+    }
+    if ( (m_headroom_run >= m_settings.headroom_frames) && (m_level > 0) ) {
+        apply(m_level - 1);
+        m_stats.step_ups++;
+        m_headroom_run = 0;
+        return true;
+    }
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+void frame_budget::apply(unsigned level) {
+    m_level = level;
+    unsigned remaining = level;
+    for ( auto& item : m_knobs ) {
+        auto knob_level = std::min(remaining, item.knob.levels - 1);
+        remaining -= knob_level;
+        if ( knob_level != item.level ) {
+            item.level = knob_level;
+            if ( item.knob.set ) {
+                item.knob.set(knob_level);
+            }
+        }
+    }
+}
+
+};  // namespace graphics
@@ -0,0 +1,169 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace graphics
+{
+
+// Stages of a frame timed against the budget
+enum class frame_phase : uint8_t { update, render, post_process, present };
+
+// Number of frame phases
+constexpr std::size_t frame_phase_count = 4;
+
+// Frame time budget and the hysteresis for changing quality
+struct budget_settings {
+    uint32_t budget_us = 16000;      // time one frame may spend across all of its phases, 0 disables the watchdog
+    uint32_t overrun_frames = 4;     // consecutive frames over budget before quality steps down
+    uint32_t headroom_frames = 120;  // consecutive frames with headroom before quality steps back up
+    uint32_t headroom_percent = 60;  // share of the budget a frame must stay under to count as headroom
+};
+
+// A setting that trades quality for frame time. Level 0 is full quality and each level above it is cheaper.
+struct quality_knob {
+    std::string name;
+    unsigned levels;                          // number of levels, including full quality
+    std::function<void(unsigned level)> set;  // apply a level
+};
+
+// Time spent in one phase of a frame
+struct phase_cost {
+    uint32_t last_us;
+    uint32_t average_us;  // exponential moving average over roughly the last eight frames
+    uint32_t peak_us;
+};
+
+// Watchdog counters
+struct budget_statistics {
+    uint64_t frames;      // frames checked against the budget
+    uint64_t overruns;    // frames over budget
+    uint64_t step_downs;  // times quality was lowered
+    uint64_t step_ups;    // times quality was raised
+    std::array<phase_cost, frame_phase_count> phases;
+};
+
+// Times each phase of a frame against a budget and adapts quality to keep frames inside it. A run of frames over
+// budget lowers quality by one step; a long run of frames well inside it raises quality by one step again. Knobs are
+// stepped in the order they are registered, so register the cheapest loss of quality first: every level of the
+// first knob is used before the second knob is touched. All calls are made on the render loop.
+class frame_budget {
+  public:
+    using clock = std::chrono::steady_clock;
+
+    // Adds the time from its construction to its destruction to a phase of the current frame
+    class scope {
+      public:
+        scope(frame_budget* budget, frame_phase phase)
+            : m_budget(budget)
+            , m_phase(phase)
+            , m_start((budget != nullptr) ? clock::now() : clock::time_point{}) { }
+
+        ~scope() {
+            if ( m_budget != nullptr ) {
+                m_budget->add(m_phase, std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - m_start));
+            }
+        }
+
+        scope(const scope&) = delete;
+        scope& operator=(const scope&) = delete;
+
+      private:
+        frame_budget* m_budget;
+        frame_phase m_phase;
+        clock::time_point m_start;
+    };
+
+    /**
+     * \brief Construct a new frame budget
+     *
+     * \param settings the budget and hysteresis
+     */
+    explicit frame_budget(const budget_settings& settings);
+
+    /**
+     * \brief register a quality knob. It is set to full quality straight away.
+     *
+     * \param knob the knob
+     * \retval std::size_t index of the knob
+     */
+    std::size_t add_knob(quality_knob knob);
+
+    // Time a phase of the current frame until the returned scope is destroyed
+    scope measure(frame_phase phase) {
+        return scope{this, phase};
+    }
+
+    // Add time to a phase of the current frame. Phases can be added to more than once per frame.
+    void add(frame_phase phase, std::chrono::microseconds elapsed);
+
+    /**
+     * \brief check the frame against the budget and step quality if a run of frames calls for it
+     *
+     * \retval true if the quality level changed
+     */
+    bool end_frame();
+
+    // Get the quality level, 0 for full quality
+    unsigned level() const {
+        return m_level;
+    }
+
+    // Get the lowest quality level, the sum of the steps of every knob
+    unsigned max_level() const;
+
+    // Get the level a knob is at
+    unsigned knob_level(std::size_t knob) const;
+
+    // Get the number of frames each level of a knob was used for
+    const std::vector<uint64_t>& knob_usage(std::size_t knob) const {
+        return m_knobs[knob].frames;
+    }
+
+    // Get the number of frames each overall quality level was used for
+    const std::vector<uint64_t>& level_usage() const {
+        return m_level_frames;
+    }
+
+    // Get the knobs
+    std::size_t knob_count() const {
+        return m_knobs.size();
+    }
+
+    const std::string& knob_name(std::size_t knob) const {
+        return m_knobs[knob].knob.name;
+    }
+
+    // Get the watchdog counters
+    budget_statistics statistics() const {
+        return m_stats;
+    }
+
+  private:
+    struct knob_state {
+        quality_knob knob;
+        unsigned level;
+        std::vector<uint64_t> frames;
+    };
+
+    // Move to an overall quality level and set every knob whose level changes
+    void apply(unsigned level);
+
+    budget_settings m_settings;
+    std::vector<knob_state> m_knobs;
+    std::array<uint32_t, frame_phase_count> m_frame_us;
+    unsigned m_level;
+    uint32_t m_over_run;
+    uint32_t m_headroom_run;
+    std::vector<uint64_t> m_level_frames;
+    budget_statistics m_stats;
+};
+
+};  // namespace graphics
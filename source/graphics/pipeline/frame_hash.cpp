@@ -0,0 +1,50 @@
+// RGB LED Matrix Graphics Library
+
+#include "frame_hash.hpp"
+
+namespace graphics
+{
+// Number of independent hash lanes. Eight 32-bit lanes fill two 128-bit vector registers.
+constexpr std::size_t hash_lanes = 8;
+
+// FNV-1a 32-bit parameters
+constexpr uint32_t fnv_offset = 0x811C9DC5;
+constexpr uint32_t fnv_prime = 0x01000193;
+
+//-----------------------------------------------------------------------------
+uint64_t hash_pixels(const packed_pixel* pixels, std::size_t count) {
+    uint32_t lanes[hash_lanes];
+    for ( std::size_t lane = 0; lane < hash_lanes; lane++ ) {
+        lanes[lane] = fnv_offset + static_cast<uint32_t>(lane);
+    }
+
+    // each lane hashes every eighth pixel
+    const packed_pixel* __restrict input = pixels;
+    std::size_t blocks = count / hash_lanes;
+    for ( std::size_t block = 0; block < blocks; block++ ) {
+        for ( std::size_t lane = 0; lane < hash_lanes; lane++ ) {
+            lanes[lane] = (lanes[lane] ^ input[block * hash_lanes + lane]) * fnv_prime;
+        }
+    }
+    for ( std::size_t i = blocks * hash_lanes; i < count; i++ ) {
+        lanes[i % hash_lanes] = (lanes[i % hash_lanes] ^ input[i]) * fnv_prime;
+    }
+
+    // mix the lanes and the length into a single 64-bit value (splitmix64 finalizer)
+    uint64_t hash = count;
+    for ( std::size_t lane = 0; lane < hash_lanes; lane++ ) {
+        hash ^= lanes[lane];
+        hash += 0x9E3779B97F4A7C15ull;
+        hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ull;
+        hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBull;
+        hash ^= hash >> 31;
+    }
+    return hash;
+}
+
+//-----------------------------------------------------------------------------
+uint64_t hash_frame(const framebuffer& frame) {
+    return hash_pixels(frame.data(), frame.size());
+}
+
+};  // namespace graphics
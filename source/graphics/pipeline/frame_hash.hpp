@@ -0,0 +1,30 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "framebuffer.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace graphics
+{
+
+/**
+ * \brief compute a 64-bit hash of a frame's pixels. The pixels are hashed in independent 32-bit lanes so the loop
+ *        runs at full vector width, and the lanes are mixed together at the end. Intended for change detection only.
+ *
+ * \param frame the frame to hash
+ * \retval uint64_t the hash
+ */
+uint64_t hash_frame(const framebuffer& frame);
+
+/**
+ * \brief compute a 64-bit hash of an array of pixels
+ *
+ * \param pixels the pixel data
+ * \param count number of pixels
+ * \retval uint64_t the hash
+ */
+uint64_t hash_pixels(const packed_pixel* pixels, std::size_t count);
+
+};  // namespace graphics
@@ -0,0 +1,53 @@
+// RGB LED Matrix Graphics Library
+
+#include "frame_pipeline.hpp"
+#include "kernels.hpp"
+#include <algorithm>
+
+namespace graphics
+{
+//-----------------------------------------------------------------------------
+frame_pipeline::frame_pipeline(int width, int height)
+    : m_output(width, height)
+    , m_physical(0, 0) { }
+
+//-----------------------------------------------------------------------------
+frame_pipeline::frame_pipeline(const pixel_remap& remap)
+    : m_output(remap.width(), remap.height())
+    , m_physical(remap.physical_width(), remap.physical_height())
+    , m_remap((remap.is_identity()) ? std::nullopt : std::optional<pixel_remap>{remap}) { }
+
+//-----------------------------------------------------------------------------
+void frame_pipeline::add_stage(std::shared_ptr<frame_stage> stage) {
+    m_stages.push_back(std::move(stage));
+}
+
+//-----------------------------------------------------------------------------
+const framebuffer& frame_pipeline::process(const framebuffer& frame) {
+    kernels::copy(m_output, frame);
+    for ( auto& stage : m_stages ) {
+        stage->process(m_output);
+    }
+
+    if ( m_remap ) {
+        m_remap->apply(m_output, m_physical);
+        return m_physical;
+    }
+    return m_output;
+}
+
+//-----------------------------------------------------------------------------
+bool frame_pipeline::is_temporal() const {
+    return std::any_of(m_stages.begin(), m_stages.end(), [](auto& stage) { return stage->is_temporal(); });
+}
+
+//-----------------------------------------------------------------------------
+uint64_t frame_pipeline::revision() const {
+    uint64_t revision = 0;
+    for ( const auto& stage : m_stages ) {
+        revision += stage->revision();
+    }
+    return revision;
+}
+
+};  // namespace graphics
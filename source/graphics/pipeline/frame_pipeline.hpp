@@ -0,0 +1,76 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "frame_stage.hpp"
+#include "framebuffer.hpp"
+#include "pixel_remap.hpp"
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace graphics
+{
+
+// Ordered set of post-processing stages applied to each rendered frame. The rendered frame is copied into
+// a working buffer before the stages run so that render targets are never modified by post-processing. An optional
+// pixel remap is applied last to put the logical frame into the physical order of the panel chain.
+class frame_pipeline {
+  public:
+    /**
+     * \brief Construct a new frame pipeline
+     *
+     * \param width width of the frames in pixels
+     * \param height height of the frames in pixels
+     */
+    frame_pipeline(int width, int height);
+
+    /**
+     * \brief Construct a new frame pipeline that outputs frames remapped onto the physical panel chain
+     *
+     * \param remap the compiled logical to physical transform. Frames passed in are of its logical size.
+     */
+    explicit frame_pipeline(const pixel_remap& remap);
+
+    /**
+     * \brief append a stage to the end of the pipeline
+     *
+     * \param stage the stage to add
+     */
+    void add_stage(std::shared_ptr<frame_stage> stage);
+
+    /**
+     * \brief run every stage over a rendered frame
+     *
+     * \param frame the rendered frame
+     * \retval const framebuffer& the processed frame in physical order, valid until the next call
+     */
+    const framebuffer& process(const framebuffer& frame);
+
+    /**
+     * \brief whether any stage produces different output for repeated input frames
+     */
+    bool is_temporal() const;
+
+    // Get a counter that changes whenever the settings of any stage change
+    uint64_t revision() const;
+
+    // Width of the frames the pipeline takes as input
+    int width() const {
+        return m_output.width();
+    }
+
+    // Height of the frames the pipeline takes as input
+    int height() const {
+        return m_output.height();
+    }
+
+  private:
+    framebuffer m_output;
+    framebuffer m_physical;
+    std::optional<pixel_remap> m_remap;
+    std::vector<std::shared_ptr<frame_stage>> m_stages;
+};
+
+};  // namespace graphics
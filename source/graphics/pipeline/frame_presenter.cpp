@@ -0,0 +1,65 @@
+// RGB LED Matrix Graphics Library
+
+#include "frame_presenter.hpp"
+#include "frame_hash.hpp"
+#include <optional>
+
+namespace graphics
+{
+//-----------------------------------------------------------------------------
+frame_presenter::frame_presenter(frame_pipeline& pipeline, present_function present, swap_function swap)
+    : m_pipeline(pipeline)
+    , m_present(std::move(present))
+    , m_swap(std::move(swap))
+    , m_snapshot(nullptr)
+    , m_budget(nullptr)
+    , m_last_hash(0)
+    , m_last_revision(0)
+    , m_valid(false)
+    , m_presented(0)
+    , m_skipped(0) { }
+
+//-----------------------------------------------------------------------------
+bool frame_presenter::present(const framebuffer& frame) {
+    std::optional<frame_budget::scope> post_process;
+    post_process.emplace(m_budget, frame_phase::post_process);
+    auto hash = hash_frame(frame);
+    auto revision = m_pipeline.revision();
+
+    // temporal stages produce a different output every frame so those frames can never be skipped, and a change to
+    // any stage's settings changes the output of an unchanged frame
+    if ( m_valid && (hash == m_last_hash) && (revision == m_last_revision) && !m_pipeline.is_temporal() ) {
+        m_skipped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    const auto& processed = m_pipeline.process(frame);
+    post_process.reset();
+    {
+        frame_budget::scope present{m_budget, frame_phase::present};
+        m_present(processed);
+    }
+    if ( m_swap ) {
+        m_swap();
+    }
+    if ( m_snapshot != nullptr ) {
+        m_snapshot->publish(frame);
+    }
+    m_last_hash = hash;
+    m_last_revision = revision;
+    m_valid = true;
+    m_presented.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+void frame_presenter::invalidate() {
+    m_valid = false;
+}
+
+//-----------------------------------------------------------------------------
+frame_statistics frame_presenter::statistics() const {
+    return frame_statistics{m_presented.load(std::memory_order_relaxed), m_skipped.load(std::memory_order_relaxed)};
+}
+
+};  // namespace graphics
@@ -0,0 +1,96 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "frame_budget.hpp"
+#include "frame_pipeline.hpp"
+#include "frame_snapshot.hpp"
+#include "framebuffer.hpp"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+
+namespace graphics
+{
+
+// Counters for presented and skipped frames
+struct frame_statistics {
+    uint64_t presented;
+    uint64_t skipped;
+};
+
+// Final step of the frame path. Completed frames are hashed and compared against the last presented frame.
+// Identical frames skip post-processing, upload and the buffer swap entirely, unless a stage's settings have changed
+// since the last frame was presented.
+class frame_presenter {
+  public:
+    // Function that uploads a processed frame to the panel, and swaps it in when no swap function is given
+    using present_function = std::function<void(const framebuffer&)>;
+
+    // Function that swaps an uploaded frame on to the panel, usually waiting for the next refresh
+    using swap_function = std::function<void()>;
+
+    /**
+     * \brief Construct a new frame presenter
+     *
+     * \param pipeline post-processing pipeline run on frames that changed
+     * \param present function to upload and swap a processed frame
+     * \param swap optional function called after present to swap the frame in. Time spent waiting in it for the
+     *        panel's refresh is idle, so it is not charged to the frame budget the way present is.
+     */
+    frame_presenter(frame_pipeline& pipeline, present_function present, swap_function swap = nullptr);
+
+    /**
+     * \brief present a completed frame if it differs from the previously presented one
+     *
+     * \param frame the rendered frame
+     * \retval true if the frame was presented, false if it was skipped
+     */
+    bool present(const framebuffer& frame);
+
+    /**
+     * \brief force the next frame to be presented even if it is unchanged
+     */
+    void invalidate();
+
+    /**
+     * \brief publish every presented frame to a snapshot for monitoring. Frames are published as rendered, before
+     *        post-processing, so snapshots show the content in display orientation but not the color correction,
+     *        power limiting and dithering applied to what the panel shows.
+     *
+     * \param snapshot the snapshot to publish to, or nullptr to stop publishing. Must outlive the presenter.
+     */
+    void set_snapshot(frame_snapshot* snapshot) {
+        m_snapshot = snapshot;
+    }
+
+    /**
+     * \brief time post-processing and presentation of every frame against a frame budget
+     *
+     * \param budget the budget to add the time to, or nullptr to stop timing. Must outlive the presenter.
+     */
+    void set_budget(frame_budget* budget) {
+        m_budget = budget;
+    }
+
+    /**
+     * \brief get the presented/skipped frame counters. Safe to call from any thread.
+     *
+     * \retval frame_statistics
+     */
+    frame_statistics statistics() const;
+
+  private:
+    frame_pipeline& m_pipeline;
+    present_function m_present;
+    swap_function m_swap;
+    frame_snapshot* m_snapshot;
+    frame_budget* m_budget;
+    uint64_t m_last_hash;
+    uint64_t m_last_revision;
+    bool m_valid;
+    std::atomic<uint64_t> m_presented;
+    std::atomic<uint64_t> m_skipped;
+};
+
+};  // namespace graphics
@@ -0,0 +1,78 @@
+// RGB LED Matrix Graphics Library
+
+#include "frame_snapshot.hpp"
+#include "kernels.hpp"
+#include <string>
+
+namespace graphics
+{
+//-----------------------------------------------------------------------------
+frame_snapshot::frame_snapshot(int width, int height)
+    : m_sequence{0, 0, 0}
+    , m_shared(0)
+    , m_back(1)
+    , m_front(2)
+    , m_published(0) {
+    for ( int i = 0; i < 3; i++ ) {
+        m_buffers.emplace_back(width, height);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void frame_snapshot::publish(const framebuffer& frame) {
+    kernels::copy(m_buffers[m_back], frame);
+    m_sequence[m_back] = m_published.load(std::memory_order_relaxed) + 1;
+    auto previous = m_shared.exchange(static_cast<uint8_t>(m_back | fresh_flag), std::memory_order_acq_rel);
+    m_back = previous & index_mask;
+    m_published.fetch_add(1, std::memory_order_relaxed);
+}
+
+//-----------------------------------------------------------------------------
+uint64_t frame_snapshot::read(framebuffer& frame) {
+    std::lock_guard<std::mutex> lock{m_read_mutex};
+    if ( m_shared.load(std::memory_order_relaxed) & fresh_flag ) {
+        m_front = m_shared.exchange(m_front, std::memory_order_acq_rel) & index_mask;
+    }
+    kernels::copy(frame, m_buffers[m_front]);
+    return m_sequence[m_front];
+}
+
+//-----------------------------------------------------------------------------
+static std::vector<uint8_t> encode_ppm(const framebuffer& frame) {
+    auto header = "P6\n" + std::to_string(frame.width()) + " " + std::to_string(frame.height()) + "\n255\n";
+    std::vector<uint8_t> image(header.begin(), header.end());
+    image.reserve(header.size() + frame.size() * 3);
+    for ( std::size_t i = 0; i < frame.size(); i++ ) {
+        auto color = frame.data()[i];
+        image.insert(image.end(), {red_channel(color), green_channel(color), blue_channel(color)});
+    }
+    return image;
+}
+
+//-----------------------------------------------------------------------------
+static std::vector<uint8_t> encode_rle(const framebuffer& frame) {
+    auto width = static_cast<uint16_t>(frame.width());
+    auto height = static_cast<uint16_t>(frame.height());
+    std::vector<uint8_t> image = {'L', 'R', 'P', 'F', static_cast<uint8_t>(width), static_cast<uint8_t>(width >> 8),
+                                  static_cast<uint8_t>(height), static_cast<uint8_t>(height >> 8)};
+
+    auto pixels = frame.data();
+    std::size_t position = 0;
+    while ( position < frame.size() ) {
+        auto color = pixels[position];
+        std::size_t run = 1;
+        while ( (run < 256) && (position + run < frame.size()) && (pixels[position + run] == color) ) {
+            run++;
+        }
+        image.insert(image.end(), {static_cast<uint8_t>(run - 1), red_channel(color), green_channel(color), blue_channel(color)});
+        position += run;
+    }
+    return image;
+}
+
+//-----------------------------------------------------------------------------
+std::vector<uint8_t> encode_snapshot(const framebuffer& frame, snapshot_format format) {
+    return (format == snapshot_format::ppm) ? encode_ppm(frame) : encode_rle(frame);
+}
+
+};  // namespace graphics
@@ -0,0 +1,78 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "framebuffer.hpp"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace graphics
+{
+
+// Encodings for snapshot images
+enum class snapshot_format {
+    ppm,  // binary PPM (P6): 3 bytes per pixel, readable by most image tools
+    rle   // "LRPF", uint16 width, uint16 height, then { uint8 run length - 1, red, green, blue } runs
+};
+
+// Latest presented frame, shared between the presenting thread and monitoring readers through a triple buffer.
+// Publishing copies into a buffer only the presenter touches and swaps it in with a single atomic exchange, so the
+// render and refresh threads never wait on a reader. Readers take the newest published buffer the same way and copy
+// it out on their own thread.
+class frame_snapshot {
+  public:
+    /**
+     * \brief Construct a new frame snapshot
+     *
+     * \param width width of the frames
+     * \param height height of the frames
+     */
+    frame_snapshot(int width, int height);
+
+    /**
+     * \brief publish a presented frame. Wait free; call from the presenting thread only.
+     *
+     * \param frame the frame
+     */
+    void publish(const framebuffer& frame);
+
+    /**
+     * \brief copy the most recently published frame
+     *
+     * \param frame frame to copy into, the same size as the snapshot
+     * \retval uint64_t number of the frame copied, counting from 1, or 0 if nothing has been published yet
+     */
+    uint64_t read(framebuffer& frame);
+
+    // Get the number of frames published so far
+    uint64_t published() const {
+        return m_published.load(std::memory_order_relaxed);
+    }
+
+  private:
+    // The buffer exchanged between writer and readers, with a flag set when it holds a frame the readers haven't taken
+    static constexpr uint8_t fresh_flag = 0x04;
+    static constexpr uint8_t index_mask = 0x03;
+
+    std::vector<framebuffer> m_buffers;
+    std::array<uint64_t, 3> m_sequence;
+    std::atomic<uint8_t> m_shared;
+    uint8_t m_back;   // owned by the presenting thread
+    uint8_t m_front;  // owned by readers, under m_read_mutex
+    std::atomic<uint64_t> m_published;
+    std::mutex m_read_mutex;
+};
+
+/**
+ * \brief encode a frame as an image
+ *
+ * \param frame the frame
+ * \param format the encoding
+ * \retval std::vector<uint8_t> the encoded image
+ */
+std::vector<uint8_t> encode_snapshot(const framebuffer& frame, snapshot_format format);
+
+};  // namespace graphics
@@ -0,0 +1,46 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "framebuffer.hpp"
+#include <cstdint>
+
+namespace graphics
+{
+
+// Post-processing stage that runs over a completed frame before it is presented on the panel
+class frame_stage {
+  public:
+    virtual ~frame_stage() = default;
+
+    /**
+     * \brief process a frame in place
+     *
+     * \param frame the frame to process
+     */
+    virtual void process(framebuffer& frame) = 0;
+
+    /**
+     * \brief whether the stage output changes from frame to frame for the same input (ex. temporal dithering)
+     */
+    virtual bool is_temporal() const {
+        return false;
+    }
+
+    // Get the number of times the stage's settings have changed. The presenter compares this to know when an unchanged
+    // frame still has to be presented again.
+    uint32_t revision() const {
+        return m_revision;
+    }
+
+  protected:
+    // Mark the stage output as changed. Called by any setter that changes how the stage processes frames.
+    void touch() {
+        m_revision++;
+    }
+
+  private:
+    uint32_t m_revision = 0;
+};
+
+};  // namespace graphics
@@ -0,0 +1,120 @@
+// RGB LED Matrix Graphics Library
+
+#include "pixel_remap.hpp"
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+namespace graphics
+{
+// Marker for physical pixels with no logical source
+constexpr uint32_t unmapped = std::numeric_limits<uint32_t>::max();
+
+//-----------------------------------------------------------------------------
+pixel_remap::pixel_remap(int physical_width, int physical_height, const remap_options& options)
+    : m_physical_width(physical_width)
+    , m_physical_height(physical_height)
+    , m_identity(true) {
+    // serpentine tiling needs the panel size, so without one the chain is left untiled
+    auto tile = options.tile;
+    if ( (tile == tiling::serpentine) && ((options.panel_width <= 0) || (options.panel_height <= 0) || (options.panel_columns <= 0)) ) {
+        tile = tiling::none;
+    }
+
+    // size of the tiled canvas before rotation
+    int tiled_width = physical_width;
+    int tiled_height = physical_height;
+    int panel_rows = 1;
+    if ( tile == tiling::u_chain ) {
+        tiled_width = physical_width / 2;
+        tiled_height = physical_height * 2;
+    } else if ( tile == tiling::serpentine ) {
+        auto panel_count = physical_width / options.panel_width;
+        panel_rows = std::max(panel_count / options.panel_columns, 1);
+        tiled_width = options.panel_columns * options.panel_width;
+        tiled_height = panel_rows * options.panel_height;
+    }
+
+    // size of the logical canvas
+    bool swap_axes = (options.rotate == rotation::rotate_90) || (options.rotate == rotation::rotate_270);
+    m_logical_width = swap_axes ? tiled_height : tiled_width;
+    m_logical_height = swap_axes ? tiled_width : tiled_height;
+
+    m_source_index.assign(static_cast<std::size_t>(physical_width) * physical_height, unmapped);
+
+    for ( int y = 0; y < m_logical_height; y++ ) {
+        for ( int x = 0; x < m_logical_width; x++ ) {
+            // mirror
+            int mx = (options.flip == mirror::horizontal) ? (m_logical_width - 1 - x) : x;
+            int my = (options.flip == mirror::vertical) ? (m_logical_height - 1 - y) : y;
+
+            // rotate clockwise onto the tiled canvas
+            int tx = mx;
+            int ty = my;
+            switch ( options.rotate ) {
+                case rotation::rotate_90:
+                    tx = m_logical_height - 1 - my;
+                    ty = mx;
+                    break;
+                case rotation::rotate_180:
+                    tx = m_logical_width - 1 - mx;
+                    ty = m_logical_height - 1 - my;
+                    break;
+                case rotation::rotate_270:
+                    tx = my;
+                    ty = m_logical_width - 1 - mx;
+                    break;
+                default:
+                    break;
+            }
+
+            // map the tiled canvas onto the chain
+            int px = tx;
+            int py = ty;
+            if ( tile == tiling::u_chain ) {
+                if ( ty < physical_height ) {
+                    px = tx + physical_width / 2;
+                } else {
+                    px = tiled_width - 1 - tx;
+                    py = tiled_height - 1 - ty;
+                }
+            } else if ( tile == tiling::serpentine ) {
+                int panel_row = ty / options.panel_height;
+                int panel_column = tx / options.panel_width;
+                int local_x = tx % options.panel_width;
+                int local_y = ty % options.panel_height;
+                if ( panel_row % 2 == 0 ) {
+                    px = (panel_row * options.panel_columns + panel_column) * options.panel_width + local_x;
+                    py = local_y;
+                } else {
+                    auto chain_index = panel_row * options.panel_columns + (options.panel_columns - 1 - panel_column);
+                    px = chain_index * options.panel_width + (options.panel_width - 1 - local_x);
+                    py = options.panel_height - 1 - local_y;
+                }
+            }
+
+            if ( (px >= 0) && (px < physical_width) && (py >= 0) && (py < physical_height) ) {
+                auto source = static_cast<uint32_t>(y * m_logical_width + x);
+                auto destination = static_cast<std::size_t>(py) * physical_width + px;
+                m_source_index[destination] = source;
+                m_identity = m_identity && (source == destination) && (m_logical_width == physical_width);
+            }
+        }
+    }
+
+    m_identity = m_identity && (std::find(m_source_index.begin(), m_source_index.end(), unmapped) == m_source_index.end());
+}
+
+//-----------------------------------------------------------------------------
+void pixel_remap::apply(const framebuffer& source, framebuffer& destination) const {
+    const auto count = std::min(m_source_index.size(), destination.size());
+    const auto source_count = static_cast<uint32_t>(source.size());
+    const uint32_t* __restrict index = m_source_index.data();
+    const packed_pixel* __restrict input = source.data();
+    packed_pixel* __restrict output = destination.data();
+    for ( std::size_t i = 0; i < count; i++ ) {
+        output[i] = (index[i] < source_count) ? input[index[i]] : 0;
+    }
+}
+
+};  // namespace graphics
@@ -0,0 +1,90 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "framebuffer.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace graphics
+{
+
+// Rotation of the logical canvas on the panels, clockwise
+enum class rotation { none, rotate_90, rotate_180, rotate_270 };
+
+// Mirroring of the logical canvas
+enum class mirror { none, horizontal, vertical };
+
+// Physical arrangement of a chain of panels
+enum class tiling {
+    none,        // panels are laid out left to right in chain order
+    u_chain,     // chain runs along the bottom row then folds back along the top row (rgb-matrix "U-mapper")
+    serpentine   // chain snakes through a grid of panels with every other row rotated 180 degrees
+};
+
+// Options describing how the logical canvas is mapped onto the physical panel chain
+struct remap_options {
+    rotation rotate = rotation::none;
+    mirror flip = mirror::none;
+    tiling tile = tiling::none;
+    int panel_width = 0;     // width of a single panel, required for serpentine tiling which is skipped without it
+    int panel_height = 0;    // height of a single panel, required for serpentine tiling
+    int panel_columns = 1;   // number of panels per row for serpentine tiling
+};
+
+// Logical to physical coordinate transform compiled into a flat lookup table. Entry i of the table holds
+// the logical pixel index shown at physical pixel index i, so applying the transform is a single gather pass.
+class pixel_remap {
+  public:
+    /**
+     * \brief Construct a new pixel remap table
+     *
+     * \param physical_width width of the driver canvas
+     * \param physical_height height of the driver canvas
+     * \param options the transform to compile
+     */
+    pixel_remap(int physical_width, int physical_height, const remap_options& options);
+
+    // Width of the logical canvas that shapes draw on
+    int width() const {
+        return m_logical_width;
+    }
+
+    // Height of the logical canvas that shapes draw on
+    int height() const {
+        return m_logical_height;
+    }
+
+    // Width of the physical driver canvas
+    int physical_width() const {
+        return m_physical_width;
+    }
+
+    // Height of the physical driver canvas
+    int physical_height() const {
+        return m_physical_height;
+    }
+
+    // True if the transform leaves every pixel where it is
+    bool is_identity() const {
+        return m_identity;
+    }
+
+    /**
+     * \brief gather a logical frame into physical order
+     *
+     * \param source frame of the logical canvas size
+     * \param destination frame of the physical canvas size
+     */
+    void apply(const framebuffer& source, framebuffer& destination) const;
+
+  private:
+    int m_logical_width;
+    int m_logical_height;
+    int m_physical_width;
+    int m_physical_height;
+    bool m_identity;
+    std::vector<uint32_t> m_source_index;
+};
+
+};  // namespace graphics
@@ -0,0 +1,48 @@
+// RGB LED Matrix Graphics Library
+
+#include "power_limiter.hpp"
+#include "kernels.hpp"
+#include <algorithm>
+
+namespace graphics
+{
+//-----------------------------------------------------------------------------
+power_limiter::power_limiter(const power_settings& settings)
+    : m_settings(settings)
+    , m_estimated_ma(0)
+    , m_limited_ma(0)
+    , m_limited_frames(0) { }
+
+//-----------------------------------------------------------------------------
+double power_limiter::estimate(const framebuffer& frame) const {
+    auto totals = kernels::channel_sums(frame);
+    auto led_ma = (totals.red * m_settings.red_ma + totals.green * m_settings.green_ma + totals.blue * m_settings.blue_ma) / 255.0;
+    return m_settings.idle_ma + led_ma * m_settings.hardware_brightness / 100.0;
+}
+
+//-----------------------------------------------------------------------------
+void power_limiter::process(framebuffer& frame) {
+    auto estimated = estimate(frame);
+    auto limited = estimated;
+
+    // a frame drawing no more than the idle current has no LED current left to scale
+    if ( (m_settings.budget_ma > 0) && (estimated > m_settings.budget_ma) && (estimated > m_settings.idle_ma) ) {
+        // only the LED current scales with the frame, the idle current is always drawn
+        auto led_budget = std::max(m_settings.budget_ma - m_settings.idle_ma, 0.0);
+        auto factor = static_cast<uint8_t>(std::clamp(255.0 * led_budget / (estimated - m_settings.idle_ma), 0.0, 254.0));
+        kernels::scale(frame, factor);
+        limited = m_settings.idle_ma + (estimated - m_settings.idle_ma) * factor / 255.0;
+        m_limited_frames.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    m_estimated_ma.store(static_cast<uint32_t>(estimated), std::memory_order_relaxed);
+    m_limited_ma.store(static_cast<uint32_t>(limited), std::memory_order_relaxed);
+}
+
+//-----------------------------------------------------------------------------
+power_statistics power_limiter::statistics() const {
+    return power_statistics{m_estimated_ma.load(std::memory_order_relaxed), m_limited_ma.load(std::memory_order_relaxed),
+                            m_limited_frames.load(std::memory_order_relaxed)};
+}
+
+};  // namespace graphics
@@ -0,0 +1,77 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "frame_stage.hpp"
+#include <atomic>
+#include <cstdint>
+
+namespace graphics
+{
+
+// Current model and budget for the power limiter
+struct power_settings {
+    double red_ma = 20.0;         // average current of one red LED at full intensity and 100% brightness
+    double green_ma = 20.0;
+    double blue_ma = 20.0;
+    double idle_ma = 0.0;         // current drawn by the whole display with every LED off
+    double budget_ma = 0.0;       // maximum estimated current, 0 disables limiting
+    int hardware_brightness = 100;  // panel brightness in percent, which scales LED current linearly
+};
+
+// Current estimates of the last processed frame
+struct power_statistics {
+    uint32_t estimated_ma;    // estimate for the frame as rendered
+    uint32_t limited_ma;      // estimate after limiting
+    uint64_t limited_frames;  // frames that were scaled down
+};
+
+// Frame stage that estimates the current the panel will draw for a frame from its summed channel intensities and
+// scales the frame down just enough to stay inside the budget. It sees frames after color correction, so the estimate
+// reflects the values actually sent to the panel.
+class power_limiter : public frame_stage {
+  public:
+    /**
+     * \brief Construct a new power limiter
+     *
+     * \param settings current model and budget
+     */
+    explicit power_limiter(const power_settings& settings);
+
+    /**
+     * \brief estimate the current for a frame and scale it into the budget if needed
+     *
+     * \param frame the frame to limit
+     */
+    void process(framebuffer& frame) override;
+
+    /**
+     * \brief estimate the current a frame would draw
+     *
+     * \param frame the frame
+     * \retval double current in milliamps
+     */
+    double estimate(const framebuffer& frame) const;
+
+    // Change the current model and budget
+    void set_settings(const power_settings& settings) {
+        m_settings = settings;
+        touch();
+    }
+
+    // Get the current model and budget
+    const power_settings& settings() const {
+        return m_settings;
+    }
+
+    // Get the estimates for the last frame. Safe to call from any thread.
+    power_statistics statistics() const;
+
+  private:
+    power_settings m_settings;
+    std::atomic<uint32_t> m_estimated_ma;
+    std::atomic<uint32_t> m_limited_ma;
+    std::atomic<uint64_t> m_limited_frames;
+};
+
+};  // namespace graphics
@@ -14,4 +14,44 @@ struct pixel {
     uint8_t blue;
 };
 
-}  // namespace graphics
\ No newline at end of file
+// Packed 32-bit pixel laid out as 0x00RRGGBB. Rows of packed pixels are arrays of aligned words
+// which is what the frame buffer kernels operate on.
+using packed_pixel = uint32_t;
+
+// Compare two pixels by value
+constexpr bool operator==(const pixel& lhs, const pixel& rhs) {
+    return (lhs.red == rhs.red) && (lhs.green == rhs.green) && (lhs.blue == rhs.blue);
+}
+
+constexpr bool operator!=(const pixel& lhs, const pixel& rhs) {
+    return !(lhs == rhs);
+}
+
+// Pack an RGB pixel into its 32-bit representation
+constexpr packed_pixel pack(uint8_t red, uint8_t green, uint8_t blue) {
+    return (static_cast<packed_pixel>(red) << 16) | (static_cast<packed_pixel>(green) << 8) | static_cast<packed_pixel>(blue);
+}
+
+constexpr packed_pixel pack(const pixel& color) {
+    return pack(color.red, color.green, color.blue);
+}
+
+// Channel accessors for packed pixels
+constexpr uint8_t red_channel(packed_pixel color) {
+    return static_cast<uint8_t>(color >> 16);
+}
+
+constexpr uint8_t green_channel(packed_pixel color) {
+    return static_cast<uint8_t>(color >> 8);
+}
+
+constexpr uint8_t blue_channel(packed_pixel color) {
+    return static_cast<uint8_t>(color);
+}
+
+// Unpack a 32-bit pixel back into an RGB pixel
+constexpr pixel unpack(packed_pixel color) {
+    return pixel{red_channel(color), green_channel(color), blue_channel(color)};
+}
+
+}  // namespace graphics
@@ -0,0 +1,229 @@
+// RGB LED Matrix Graphics Library
+
+#include "scene_playlist.hpp"
+#include "kernels.hpp"
+#include <algorithm>
+
+namespace graphics
+{
+//-----------------------------------------------------------------------------
+scene_playlist::scene_playlist(int width, int height, std::chrono::milliseconds crossfade)
+    : m_crossfade(crossfade)
+    , m_fade_frame(width, height)
+    , m_prerender_frame(width, height)
+    , m_current_index(0)
+    , m_waiting(false)
+    , m_ready(nullptr)
+    , m_ready_index(0)
+    , m_retired(nullptr)
+    , m_requested(false)
+    , m_request_index(0)
+    , m_running(false)
+    , m_switches(0)
+    , m_late(0)
+    , m_crossfade_frames(0)
+    , m_max_prepare_us(0)
+    , m_failed_builds(0) { }
+
+//-----------------------------------------------------------------------------
+scene_playlist::~scene_playlist() {
+    stop();
+}
+
+//-----------------------------------------------------------------------------
+void scene_playlist::add(playlist_entry entry) {
+    m_entries.push_back(std::move(entry));
+}
+
+//-----------------------------------------------------------------------------
+void scene_playlist::start(clock::time_point now) {
+    if ( m_thread.joinable() || m_entries.empty() ) {
+        return;
+    }
+    m_running = true;
+    m_current_index = 0;
+    m_waiting = true;
+    m_thread = std::thread([this]() { prepare(); });
+    request(0, now);
+}
+
+//-----------------------------------------------------------------------------
+void scene_playlist::stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_running = false;
+    }
+    m_wake.notify_one();
+    if ( m_thread.joinable() ) {
+        m_thread.join();
+    }
+    delete m_ready.exchange(nullptr);
+    delete m_retired.exchange(nullptr);
+    m_current.reset();
+    m_outgoing.reset();
+    m_requested = false;
+}
+
+//-----------------------------------------------------------------------------
+void scene_playlist::request(std::size_t index, clock::time_point start) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_requested = true;
+        m_request_index = index;
+        m_request_start = start;
+    }
+    m_wake.notify_one();
+}
+
+//-----------------------------------------------------------------------------
+void scene_playlist::retire(std::unique_ptr<playlist_item> item) {
+    // an item is retired at most once per switch, so the slot is normally empty. If the preparation thread has fallen
+    // a whole item behind, the older item is released here rather than blocking.
+    delete m_retired.exchange(item.release());
+    m_wake.notify_one();
+}
+
+//-----------------------------------------------------------------------------
+void scene_playlist::prepare() {
+    if ( m_thread_start_handler ) {
+        m_thread_start_handler();
+    }
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while ( true ) {
+        m_wake.wait(lock, [this]() { return !m_running || m_requested || (m_retired.load() != nullptr); });
+        if ( !m_running ) {
+            break;
+        }
+        auto retired = m_retired.exchange(nullptr);
+        if ( !m_requested ) {
+            lock.unlock();
+            delete retired;
+            lock.lock();
+            continue;
+        }
+
+        m_requested = false;
+        auto requested = m_request_index;
+        auto start = m_request_start;
+        lock.unlock();
+        delete retired;
+
+        // build the item and render its first frame once so the render thread only ever draws a warm item. Entries
+        // that fail to build are skipped in favour of the ones after them.
+        auto begin = clock::now();
+        std::unique_ptr<playlist_item> item;
+        auto index = requested;
+        for ( std::size_t attempt = 0; !item && (attempt < m_entries.size()); attempt++ ) {
+            index = (requested + attempt) % m_entries.size();
+            item = m_entries[index].build();
+            m_failed_builds.fetch_add(item ? 0 : 1, std::memory_order_relaxed);
+        }
+        if ( item ) {
+            item->render(m_prerender_frame, start);
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - begin).count();
+        auto longest = m_max_prepare_us.load(std::memory_order_relaxed);
+        if ( elapsed > longest ) {
+            m_max_prepare_us.store(elapsed, std::memory_order_relaxed);
+        }
+
+        if ( !item ) {
+            // nothing could be built, so try the same request again after a pause unless a new one arrives first
+            lock.lock();
+            m_wake.wait_for(lock, build_retry, [this]() { return !m_running || m_requested; });
+            if ( !m_requested ) {
+                m_requested = true;
+                m_request_index = requested;
+                m_request_start = start;
+            }
+            continue;
+        }
+
+        m_ready_index.store(index, std::memory_order_relaxed);
+        delete m_ready.exchange(item.release(), std::memory_order_acq_rel);
+        if ( m_ready_handler ) {
+            m_ready_handler();
+        }
+        lock.lock();
+    }
+}
+
+//-----------------------------------------------------------------------------
+bool scene_playlist::render(framebuffer& frame, clock::time_point now) {
+    if ( !m_current || (now >= m_switch_time) ) {
+        auto ready = m_ready.exchange(nullptr, std::memory_order_acq_rel);
+        if ( ready != nullptr ) {
+            if ( m_current && (m_crossfade.count() > 0) ) {
+                if ( m_outgoing ) {
+                    retire(std::move(m_outgoing));
+                }
+                m_outgoing = std::move(m_current);
+                m_fade_start = now;
+            } else if ( m_current ) {
+                retire(std::move(m_current));
+            }
+            m_current.reset(ready);
+            m_current_index = m_ready_index.load(std::memory_order_relaxed);
+
+            // keep to the playlist's timeline unless the item arrived late, in which case it still gets its full time
+            auto duration = m_entries[m_current_index].duration;
+            if ( m_waiting ) {
+                m_late += (m_switches > 0) ? 1 : 0;
+                m_switch_time = now + duration;
+            } else {
+                m_switch_time += duration;
+            }
+            m_waiting = false;
+            m_switches++;
+
+            request((m_current_index + 1) % m_entries.size(), m_switch_time);
+        } else if ( m_current ) {
+            m_waiting = true;
+        }
+    }
+
+    if ( !m_current ) {
+        return false;
+    }
+    m_current->render(frame, now);
+
+    if ( m_outgoing ) {
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - m_fade_start);
+        if ( elapsed >= m_crossfade ) {
+            retire(std::move(m_outgoing));
+        } else {
+            m_outgoing->render(m_fade_frame, now);
+            auto alpha = static_cast<uint8_t>(255 - (255 * elapsed.count()) / m_crossfade.count());
+            kernels::blend(frame, m_fade_frame, alpha);
+            m_crossfade_frames++;
+        }
+    }
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+std::optional<scene_playlist::clock::time_point> scene_playlist::next_deadline(clock::time_point now) const {
+    if ( !m_running ) {
+        return {};
+    }
+    if ( m_outgoing ) {
+        return now;
+    }
+    // a late item is picked up by the first frame after it is ready. Poll for it rather than spinning the render core
+    // the preparation thread needs.
+    if ( !m_current || m_waiting ) {
+        return now + ready_poll;
+    }
+    return std::max(now, m_switch_time);
+}
+
+//-----------------------------------------------------------------------------
+playlist_statistics scene_playlist::statistics() const {
+    return playlist_statistics{m_switches,
+                               m_late,
+                               m_crossfade_frames,
+                               std::chrono::microseconds{m_max_prepare_us.load(std::memory_order_relaxed)},
+                               m_failed_builds.load(std::memory_order_relaxed)};
+}
+
+};  // namespace graphics
@@ -0,0 +1,184 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "framebuffer.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace graphics
+{
+
+// Content shown by a playlist entry
+class playlist_item {
+  public:
+    virtual ~playlist_item() = default;
+
+    /**
+     * \brief draw the item into a frame. Runs on the render thread every frame the item is shown, and once on the
+     *        preparation thread ahead of time so caches such as static layers are already filled.
+     *
+     * \param frame the frame to draw into
+     * \param now the frame time
+     */
+    virtual void render(framebuffer& frame, std::chrono::steady_clock::time_point now) = 0;
+};
+
+// Entry of a playlist. The build function does all of the expensive work of putting the item together, such as
+// loading fonts and laying out text, and runs on the preparation thread.
+struct playlist_entry {
+    std::string name;
+    std::chrono::milliseconds duration;
+    std::function<std::unique_ptr<playlist_item>()> build;
+};
+
+// Playlist counters
+struct playlist_statistics {
+    uint64_t switches;                      // handoffs to the next item
+    uint64_t late;                          // handoffs made after their start time because the item was not ready
+    uint64_t crossfade_frames;              // frames blending two items
+    std::chrono::microseconds max_prepare;  // longest build and pre-render of an item
+    uint64_t failed_builds;                 // entries skipped because their build returned nothing
+};
+
+// Rotates through a list of items. While one item is shown the next one is built and pre-rendered on a background
+// thread, then handed to the render thread through an atomic pointer. The render thread picks it up at the first
+// frame at or after its start time, so a switch costs a pointer exchange and never stalls a frame. Items can
+// optionally crossfade. Items that go out of use are handed back so they are destroyed on the background thread too.
+// Entries whose build returns nothing are skipped, and if no entry builds the whole list is retried after a pause.
+class scene_playlist {
+  public:
+    using clock = std::chrono::steady_clock;
+
+    // How often the render thread checks for an item that is late, when no ready handler wakes it
+    static constexpr std::chrono::milliseconds ready_poll{5};
+
+    // How long the preparation thread waits before retrying after no entry could be built
+    static constexpr std::chrono::milliseconds build_retry{1000};
+
+    /**
+     * \brief Construct a new scene playlist
+     *
+     * \param width width of the frames items render
+     * \param height height of the frames items render
+     * \param crossfade length of the blend between items, zero to cut
+     */
+    scene_playlist(int width, int height, std::chrono::milliseconds crossfade = std::chrono::milliseconds{0});
+
+    ~scene_playlist();
+
+    // Add an entry to the end of the playlist. Entries must all be added before the playlist starts.
+    void add(playlist_entry entry);
+
+    /**
+     * \brief start preparing the first entry. It is shown from the first frame after it is ready.
+     *
+     * \param now the current time
+     */
+    void start(clock::time_point now);
+
+    // Stop the preparation thread and release all items
+    void stop();
+
+    /**
+     * \brief set a function the preparation thread calls each time an item is ready, for example to reschedule the
+     *        render loop so a late item is shown straight away. Set it before starting the playlist.
+     *
+     * \param handler the function, which must be safe to call from the preparation thread
+     */
+    void set_ready_handler(std::function<void()> handler) {
+        m_ready_handler = std::move(handler);
+    }
+
+    /**
+     * \brief set a function the preparation thread runs first, for example to set its cores and scheduling policy. Set
+     *        it before starting the playlist.
+     *
+     * \param handler the function, called on the preparation thread
+     */
+    void set_thread_start_handler(std::function<void()> handler) {
+        m_thread_start_handler = std::move(handler);
+    }
+
+    /**
+     * \brief draw the current item, switching to the next one if its start time has passed and it is ready. Call on the
+     *        render thread once per frame.
+     *
+     * \param frame the frame to draw into
+     * \param now the frame time
+     * \retval bool false if no item is ready to show yet
+     */
+    bool render(framebuffer& frame, clock::time_point now);
+
+    /**
+     * \brief time the playlist next needs a frame: the next switch, now while crossfading, or a short poll while an
+     *        item is late
+     *
+     * \param now the current time
+     * \retval std::optional<clock::time_point> the deadline, or nothing before the playlist starts
+     */
+    std::optional<clock::time_point> next_deadline(clock::time_point now) const;
+
+    // Get the index of the entry shown
+    std::size_t current() const {
+        return m_current_index;
+    }
+
+    // Get the playlist counters
+    playlist_statistics statistics() const;
+
+  private:
+    // Preparation thread body
+    void prepare();
+
+    // Ask the preparation thread to build an entry for a start time
+    void request(std::size_t index, clock::time_point start);
+
+    // Hand an item back to the preparation thread to be destroyed
+    void retire(std::unique_ptr<playlist_item> item);
+
+    std::vector<playlist_entry> m_entries;
+    std::chrono::milliseconds m_crossfade;
+    framebuffer m_fade_frame;
+    framebuffer m_prerender_frame;
+
+    // owned by the render thread
+    std::unique_ptr<playlist_item> m_current;
+    std::unique_ptr<playlist_item> m_outgoing;
+    std::size_t m_current_index;
+    clock::time_point m_switch_time;
+    clock::time_point m_fade_start;
+    bool m_waiting;
+
+    // handoff between the threads
+    std::function<void()> m_ready_handler;
+    std::function<void()> m_thread_start_handler;
+    std::atomic<playlist_item*> m_ready;
+    std::atomic<std::size_t> m_ready_index;  // entry of the ready item, stored before the item is published
+    std::atomic<playlist_item*> m_retired;
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    bool m_requested;
+    std::size_t m_request_index;
+    clock::time_point m_request_start;
+    bool m_running;
+    std::thread m_thread;
+
+    uint64_t m_switches;
+    uint64_t m_late;
+    uint64_t m_crossfade_frames;
+    std::atomic<int64_t> m_max_prepare_us;
+    std::atomic<uint64_t> m_failed_builds;
+};
+
+};  // namespace graphics
@@ -0,0 +1,85 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+namespace graphics
+{
+
+// Axis aligned rectangle in display coordinates. Covers x to x + width - 1 and y to y + height - 1.
+struct rect {
+    int16_t x;
+    int16_t y;
+    uint16_t width;
+    uint16_t height;
+};
+
+constexpr bool operator==(const rect& lhs, const rect& rhs) {
+    return (lhs.x == rhs.x) && (lhs.y == rhs.y) && (lhs.width == rhs.width) && (lhs.height == rhs.height);
+}
+
+constexpr bool operator!=(const rect& lhs, const rect& rhs) {
+    return !(lhs == rhs);
+}
+
+// Make a rectangle from its edges, saturating to the range a rect can hold instead of wrapping. Rectangles that cover
+// the whole display, such as the default bounds of a shape, can then be moved and merged without shrinking.
+constexpr rect make_rect(int left, int top, int right, int bottom) {
+    auto x = std::clamp<int>(left, INT16_MIN, INT16_MAX);
+    auto y = std::clamp<int>(top, INT16_MIN, INT16_MAX);
+    auto width = std::clamp<int>(right - x, 0, UINT16_MAX);
+    auto height = std::clamp<int>(bottom - y, 0, UINT16_MAX);
+    return rect{static_cast<int16_t>(x), static_cast<int16_t>(y), static_cast<uint16_t>(width), static_cast<uint16_t>(height)};
+}
+
+// Move a rectangle, saturating as make_rect does
+constexpr rect translate(const rect& area, int dx, int dy) {
+    return make_rect(area.x + dx, area.y + dy, area.x + dx + area.width, area.y + dy + area.height);
+}
+
+// Check if a rectangle covers no pixels
+constexpr bool is_empty(const rect& area) {
+    return (area.width == 0) || (area.height == 0);
+}
+
+// Check if a point is inside a rectangle
+constexpr bool contains(const rect& area, int x, int y) {
+    return (x >= area.x) && (x < area.x + area.width) && (y >= area.y) && (y < area.y + area.height);
+}
+
+// Get the overlap of two rectangles, empty if they do not overlap
+constexpr rect intersect(const rect& a, const rect& b) {
+    int left = std::max<int>(a.x, b.x);
+    int top = std::max<int>(a.y, b.y);
+    int right = std::min(a.x + a.width, b.x + b.width);
+    int bottom = std::min(a.y + a.height, b.y + b.height);
+    if ( (right <= left) || (bottom <= top) ) {
+        return rect{0, 0, 0, 0};
+    }
+    return make_rect(left, top, right, bottom);
+}
+
+// Check if two rectangles share any pixels
+constexpr bool overlaps(const rect& a, const rect& b) {
+    return !is_empty(intersect(a, b));
+}
+
+// Get the smallest rectangle covering both rectangles, saturating if it is too large to hold. Empty rectangles are
+// ignored.
+constexpr rect unite(const rect& a, const rect& b) {
+    if ( is_empty(a) ) {
+        return b;
+    }
+    if ( is_empty(b) ) {
+        return a;
+    }
+    int left = std::min<int>(a.x, b.x);
+    int top = std::min<int>(a.y, b.y);
+    int right = std::max(a.x + a.width, b.x + b.width);
+    int bottom = std::max(a.y + a.height, b.y + b.height);
+    return make_rect(left, top, right, bottom);
+}
+
+};  // namespace graphics
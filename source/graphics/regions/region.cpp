@@ -0,0 +1,47 @@
+// RGB LED Matrix Graphics Library
+
+#include "region.hpp"
+#include <algorithm>
+
+namespace graphics
+{
+//-----------------------------------------------------------------------------
+region::region(const std::string& name, const rect& bounds)
+    : m_name(name)
+    , m_bounds(bounds)
+    , m_frame(bounds.width, bounds.height)
+    , m_canvas(&m_frame)
+    , m_dirty(true) { }
+
+//-----------------------------------------------------------------------------
+void region::clear() {
+    draw([](canvas& canvas) { canvas.clear(); });
+}
+
+//-----------------------------------------------------------------------------
+void region::fill(const pixel& color) {
+    draw([&color](canvas& canvas) { canvas.fill(color.red, color.green, color.blue); });
+}
+
+//-----------------------------------------------------------------------------
+bool region::compose_into(framebuffer& frame) {
+    // claim the dirty flag first so a draw that lands during the copy is picked up by the next compose
+    if ( !m_dirty.exchange(false) ) {
+        return false;
+    }
+
+    auto visible = intersect(m_bounds, rect{0, 0, static_cast<uint16_t>(frame.width()), static_cast<uint16_t>(frame.height())});
+    if ( is_empty(visible) ) {
+        return true;
+    }
+
+    std::lock_guard<std::mutex> lock{m_mutex};
+    auto source_x = visible.x - m_bounds.x;
+    for ( int y = 0; y < visible.height; y++ ) {
+        auto source = m_frame.row(visible.y - m_bounds.y + y) + source_x;
+        std::copy(source, source + visible.width, frame.row(visible.y + y) + visible.x);
+    }
+    return true;
+}
+
+};  // namespace graphics
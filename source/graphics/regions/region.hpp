@@ -0,0 +1,84 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "canvas.hpp"
+#include "framebuffer.hpp"
+#include "pixel.hpp"
+#include "rect.hpp"
+#include <atomic>
+#include <mutex>
+#include <string>
+
+namespace graphics
+{
+
+// Named rectangular part of the display with its own off-screen frame. Drawing goes through a canvas clipped to the
+// region with (0, 0) at the region's top-left corner, so clearing the canvas only clears the region. Each region has its
+// own lock, so tasks drawing into different regions never wait on each other.
+class region {
+  public:
+    /**
+     * \brief Construct a new region
+     *
+     * \param name name of the region
+     * \param bounds area of the display the region covers
+     */
+    region(const std::string& name, const rect& bounds);
+
+    /**
+     * \brief draw into the region and mark it dirty
+     *
+     * \param draw_function callable taking a canvas& for the region
+     */
+    template <typename Function>
+    void draw(Function&& draw_function) {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        draw_function(m_canvas);
+        m_dirty = true;
+    }
+
+    // Clear the region to black
+    void clear();
+
+    // Fill the region with a color
+    void fill(const pixel& color);
+
+    /**
+     * \brief copy the region into a frame at its bounds if it has changed since the last copy
+     *
+     * \param frame frame to copy into
+     * \retval true if the region was dirty and has been copied
+     */
+    bool compose_into(framebuffer& frame);
+
+    // Check if the region has changed since it was last composed
+    bool is_dirty() const {
+        return m_dirty;
+    }
+
+    // Force the region to be composed into the next frame
+    void mark_dirty() {
+        m_dirty = true;
+    }
+
+    // Get the region's name
+    const std::string& name() const {
+        return m_name;
+    }
+
+    // Get the area of the display the region covers
+    const rect& bounds() const {
+        return m_bounds;
+    }
+
+  private:
+    std::string m_name;
+    rect m_bounds;
+    framebuffer m_frame;
+    canvas m_canvas;
+    std::mutex m_mutex;
+    std::atomic<bool> m_dirty;
+};
+
+};  // namespace graphics
@@ -0,0 +1,49 @@
+// RGB LED Matrix Graphics Library
+
+#include "region_display.hpp"
+#include <algorithm>
+
+namespace graphics
+{
+//-----------------------------------------------------------------------------
+region_display::region_display(int width, int height)
+    : m_width(width)
+    , m_height(height) { }
+
+//-----------------------------------------------------------------------------
+expected<region*, std::string> region_display::add_region(const std::string& name, const rect& bounds) {
+    auto display = rect{0, 0, static_cast<uint16_t>(m_width), static_cast<uint16_t>(m_height)};
+    if ( is_empty(bounds) || (intersect(bounds, display) != bounds) ) {
+        return expected<region*, std::string>::error("Region " + name + " is empty or outside of the display");
+    }
+
+    for ( const auto& existing : m_regions ) {
+        if ( existing->name() == name ) {
+            return expected<region*, std::string>::error("Region " + name + " already exists");
+        }
+        if ( overlaps(existing->bounds(), bounds) ) {
+            return expected<region*, std::string>::error("Region " + name + " overlaps region " + existing->name());
+        }
+    }
+
+    m_regions.push_back(std::make_unique<region>(name, bounds));
+    return expected<region*, std::string>::success(m_regions.back().get());
+}
+
+//-----------------------------------------------------------------------------
+region* region_display::find(const std::string& name) {
+    auto it = std::find_if(m_regions.begin(), m_regions.end(), [&name](const auto& candidate) { return candidate->name() == name; });
+    return (it != m_regions.end()) ? it->get() : nullptr;
+}
+
+//-----------------------------------------------------------------------------
+int region_display::compose(framebuffer& frame) {
+    std::lock_guard<std::mutex> lock{m_compose_mutex};
+    int composed = 0;
+    for ( auto& item : m_regions ) {
+        composed += item->compose_into(frame) ? 1 : 0;
+    }
+    return composed;
+}
+
+};  // namespace graphics
@@ -0,0 +1,67 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "expected.hpp"
+#include "framebuffer.hpp"
+#include "rect.hpp"
+#include "region.hpp"
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace graphics
+{
+
+// Display partitioned into non-overlapping named regions. Regions are updated independently and only the ones that
+// changed are copied into the output frame, so nothing is cleared or redrawn globally. Regions should all be added
+// before tasks start drawing into them.
+class region_display {
+  public:
+    /**
+     * \brief Construct a new region display
+     *
+     * \param width width of the display
+     * \param height height of the display
+     */
+    region_display(int width, int height);
+
+    /**
+     * \brief add a region to the display
+     *
+     * \param name unique name of the region
+     * \param bounds area of the display it covers. Must be inside the display and not overlap another region.
+     * \retval expected<region*, std::string> the new region, owned by the display
+     */
+    expected<region*, std::string> add_region(const std::string& name, const rect& bounds);
+
+    /**
+     * \brief find a region by name
+     *
+     * \param name name of the region
+     * \retval region* the region, or nullptr if there is none with that name
+     */
+    region* find(const std::string& name);
+
+    /**
+     * \brief copy every dirty region into a frame. Pixels outside of dirty regions are left untouched.
+     *
+     * \param frame the frame to compose into
+     * \retval int number of regions copied
+     */
+    int compose(framebuffer& frame);
+
+    // Get the regions in the order they were added
+    const std::vector<std::unique_ptr<region>>& regions() const {
+        return m_regions;
+    }
+
+  private:
+    int m_width;
+    int m_height;
+    std::vector<std::unique_ptr<region>> m_regions;
+    std::mutex m_compose_mutex;
+};
+
+};  // namespace graphics
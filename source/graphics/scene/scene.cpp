@@ -0,0 +1,136 @@
+// RGB LED Matrix Graphics Library
+
+#include "scene.hpp"
+#include <algorithm>
+#include <cstddef>
+
+namespace graphics
+{
+//-----------------------------------------------------------------------------
+scene::scene(const pixel& background, std::size_t max_damage)
+    : m_background(background)
+    , m_max_damage(std::max<std::size_t>(max_damage, 1))
+    , m_full(true)
+    , m_viewport{0, 0, 0, 0}
+    , m_stats{0, 0, 0} { }
+
+//-----------------------------------------------------------------------------
+int scene::render(canvas& canvas) {
+    m_damage.clear();
+    m_viewport = rect{0, 0, static_cast<uint16_t>(canvas.width()), static_cast<uint16_t>(canvas.height())};
+    if ( m_full ) {
+        add_damage(m_viewport);
+        m_full = false;
+    }
+    check_revisions(m_root);
+    if ( m_root.m_subtree_dirty ) {
+        collect(m_root, 0, 0, false, false);
+    }
+    if ( m_damage.empty() ) {
+        return 0;
+    }
+
+    for ( const auto& area : m_damage ) {
+        auto clipped = canvas.clipped(area);
+        clipped.fill(m_background.red, m_background.green, m_background.blue);
+        draw(m_root, clipped, area, 0, 0);
+        m_stats.pixels_damaged += static_cast<uint64_t>(area.width) * area.height;
+    }
+    m_stats.renders++;
+    return static_cast<int>(m_damage.size());
+}
+
+//-----------------------------------------------------------------------------
+void scene::invalidate_all() {
+    m_full = true;
+}
+
+//-----------------------------------------------------------------------------
+void scene::check_revisions(scene_node& node) {
+    if ( node.m_item && (node.m_item->revision() != node.m_revision) ) {
+        node.invalidate();
+    }
+    for ( auto& child : node.m_children ) {
+        check_revisions(*child);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void scene::collect(scene_node& node, int x, int y, bool placed, bool hidden) {
+    x += node.m_x;
+    y += node.m_y;
+    placed = placed || node.m_moved;
+    hidden = hidden || !node.m_visible;
+
+    if ( node.m_dirty || placed ) {
+        add_damage(node.m_drawn);
+        node.m_drawn = rect{0, 0, 0, 0};
+        if ( !hidden && node.m_item ) {
+            node.m_drawn = translate(node.m_item->bounds(), x, y);
+        }
+        node.m_revision = node.m_item ? node.m_item->revision() : 0;
+        add_damage(node.m_drawn);
+    }
+    add_damage(node.m_removed);
+    node.m_removed = rect{0, 0, 0, 0};
+
+    // children that did not change keep their placement unless this node moved
+    auto subtree = node.m_drawn;
+    for ( auto& child : node.m_children ) {
+        if ( placed || child->m_subtree_dirty ) {
+            collect(*child, x, y, placed, hidden);
+        }
+        subtree = unite(subtree, child->m_subtree);
+    }
+    node.m_subtree = subtree;
+    node.m_dirty = false;
+    node.m_moved = false;
+    node.m_subtree_dirty = false;
+}
+
+//-----------------------------------------------------------------------------
+void scene::draw(scene_node& node, canvas& canvas, const rect& area, int x, int y) {
+    if ( !node.m_visible || !overlaps(node.m_subtree, area) ) {
+        return;
+    }
+    x += node.m_x;
+    y += node.m_y;
+    if ( node.m_item && overlaps(node.m_drawn, area) ) {
+        auto placed = canvas.translated(x, y);
+        node.m_item->draw(placed);
+        m_stats.nodes_drawn++;
+    }
+    for ( auto& child : node.m_children ) {
+        draw(*child, canvas, area, x, y);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void scene::add_damage(const rect& area) {
+    auto damage = intersect(area, m_viewport);
+    if ( is_empty(damage) ) {
+        return;
+    }
+
+    // merging can make the rectangle overlap ones it was checked against already, so start over after each merge
+    for ( std::size_t i = 0; i < m_damage.size(); ) {
+        if ( overlaps(m_damage[i], damage) ) {
+            damage = unite(m_damage[i], damage);
+            m_damage.erase(m_damage.begin() + static_cast<std::ptrdiff_t>(i));
+            i = 0;
+        } else {
+            i++;
+        }
+    }
+    m_damage.push_back(damage);
+
+    if ( m_damage.size() > m_max_damage ) {
+        auto merged = m_damage.front();
+        for ( const auto& rectangle : m_damage ) {
+            merged = unite(merged, rectangle);
+        }
+        m_damage.assign(1, merged);
+    }
+}
+
+};  // namespace graphics
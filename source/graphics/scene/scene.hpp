@@ -0,0 +1,87 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "canvas.hpp"
+#include "pixel.hpp"
+#include "rect.hpp"
+#include "scene_node.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace graphics
+{
+
+// Retained-mode scene of shapes arranged in a tree. The scene owns the area it is rendered into: each render walks only
+// the branches flagged as changed to collect damaged rectangles, then clears and redraws just those rectangles with
+// the nodes that overlap them. An unchanged scene costs nothing to render and a change costs in proportion to the area
+// it touches, not to the size of the tree. Shapes that change through their own setters are picked up by comparing
+// their revision counters, which is one check per node and render. The scene is not thread safe; change and render it
+// from one thread.
+class scene {
+  public:
+    // Render counters
+    struct statistics {
+        uint64_t renders;         // renders that redrew anything
+        uint64_t nodes_drawn;     // shapes drawn
+        uint64_t pixels_damaged;  // pixels cleared and redrawn
+    };
+
+    /**
+     * \brief Construct a new scene
+     *
+     * \param background color damaged areas are cleared to before redrawing
+     * \param max_damage number of separate damaged rectangles kept before they are merged into one
+     */
+    explicit scene(const pixel& background = pixel{0, 0, 0}, std::size_t max_damage = 8);
+
+    // Get the root node of the scene
+    scene_node& root() {
+        return m_root;
+    }
+
+    /**
+     * \brief redraw the damaged parts of the scene on a canvas
+     *
+     * \param canvas the canvas to draw on, which must still hold the previous render
+     * \retval int number of damaged rectangles redrawn
+     */
+    int render(canvas& canvas);
+
+    // Redraw the whole canvas on the next render, for when something else has drawn over it
+    void invalidate_all();
+
+    // Get the rectangles redrawn by the last render
+    const std::vector<rect>& damage() const {
+        return m_damage;
+    }
+
+    // Get the render counters
+    statistics stats() const {
+        return m_stats;
+    }
+
+  private:
+    // Mark nodes whose shapes changed through their own setters since they were last collected
+    void check_revisions(scene_node& node);
+
+    // Update the placement of a changed branch and record the area it damaged
+    void collect(scene_node& node, int x, int y, bool placed, bool hidden);
+
+    // Redraw the nodes of a branch that overlap a damaged area
+    void draw(scene_node& node, canvas& canvas, const rect& area, int x, int y);
+
+    // Add an area to the damage list, merging it with any rectangle it overlaps
+    void add_damage(const rect& area);
+
+    scene_node m_root;
+    pixel m_background;
+    std::size_t m_max_damage;
+    bool m_full;
+    rect m_viewport;
+    std::vector<rect> m_damage;
+    statistics m_stats;
+};
+
+};  // namespace graphics
@@ -0,0 +1,79 @@
+// RGB LED Matrix Graphics Library
+
+#include "scene_node.hpp"
+#include <algorithm>
+
+namespace graphics
+{
+//-----------------------------------------------------------------------------
+scene_node::scene_node(std::shared_ptr<shape> item, int x, int y)
+    : m_item(std::move(item))
+    , m_parent(nullptr)
+    , m_x(static_cast<int16_t>(x))
+    , m_y(static_cast<int16_t>(y))
+    , m_visible(true)
+    , m_dirty(true)
+    , m_moved(true)
+    , m_subtree_dirty(true)
+    , m_drawn{0, 0, 0, 0}
+    , m_subtree{0, 0, 0, 0}
+    , m_removed{0, 0, 0, 0}
+    , m_revision(0) { }
+
+//-----------------------------------------------------------------------------
+scene_node* scene_node::add_child(std::unique_ptr<scene_node> child) {
+    child->m_parent = this;
+    child->m_moved = true;
+    child->m_subtree_dirty = true;
+    m_children.push_back(std::move(child));
+    propagate();
+    return m_children.back().get();
+}
+
+//-----------------------------------------------------------------------------
+bool scene_node::remove_child(scene_node* child) {
+    auto it = std::find_if(m_children.begin(), m_children.end(), [child](const auto& node) { return node.get() == child; });
+    if ( it == m_children.end() ) {
+        return false;
+    }
+    m_removed = unite(m_removed, child->m_subtree);
+    m_children.erase(it);
+    propagate();
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+void scene_node::set_position(int x, int y) {
+    if ( (x == m_x) && (y == m_y) ) {
+        return;
+    }
+    m_x = static_cast<int16_t>(x);
+    m_y = static_cast<int16_t>(y);
+    m_moved = true;
+    propagate();
+}
+
+//-----------------------------------------------------------------------------
+void scene_node::set_visible(bool visible) {
+    if ( visible == m_visible ) {
+        return;
+    }
+    m_visible = visible;
+    m_moved = true;
+    propagate();
+}
+
+//-----------------------------------------------------------------------------
+void scene_node::invalidate() {
+    m_dirty = true;
+    propagate();
+}
+
+//-----------------------------------------------------------------------------
+void scene_node::propagate() {
+    for ( auto node = this; (node != nullptr) && !node->m_subtree_dirty; node = node->m_parent ) {
+        node->m_subtree_dirty = true;
+    }
+}
+
+};  // namespace graphics
@@ -0,0 +1,110 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "rect.hpp"
+#include "shape.hpp"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace graphics
+{
+
+// Node of a retained scene. A node places an optional shape, and all of its children, at an offset from its parent,
+// so moving a node moves the whole subtree. Every change marks the node dirty and flags its ancestors so the scene
+// only visits the parts of the tree that changed when it collects damage.
+class scene_node {
+  public:
+    /**
+     * \brief Construct a new scene node
+     *
+     * \param item shape drawn by the node, in the node's coordinates. May be empty for grouping nodes.
+     * \param x horizontal offset from the parent
+     * \param y vertical offset from the parent
+     */
+    explicit scene_node(std::shared_ptr<shape> item = nullptr, int x = 0, int y = 0);
+
+    /**
+     * \brief add a child node. Children draw after their parent, in the order they are added.
+     *
+     * \param child the child to add
+     * \retval scene_node* the child, owned by this node
+     */
+    scene_node* add_child(std::unique_ptr<scene_node> child);
+
+    /**
+     * \brief remove a child node and damage the area it covered
+     *
+     * \param child the child to remove
+     * \retval bool true if the node was a child of this node
+     */
+    bool remove_child(scene_node* child);
+
+    // Move the node, and everything below it, relative to its parent
+    void set_position(int x, int y);
+
+    // Show or hide the node and everything below it
+    void set_visible(bool visible);
+
+    // Mark the node's shape as changed so it is redrawn on the next render. Only needed for shapes that change without
+    // updating their revision.
+    void invalidate();
+
+    // Get the shape drawn by the node
+    shape* item() const {
+        return m_item.get();
+    }
+
+    // Get the horizontal offset from the parent
+    int x() const {
+        return m_x;
+    }
+
+    // Get the vertical offset from the parent
+    int y() const {
+        return m_y;
+    }
+
+    // Check if the node is shown
+    bool is_visible() const {
+        return m_visible;
+    }
+
+    // Check if anything at or below the node changed since the last render
+    bool is_dirty() const {
+        return m_subtree_dirty;
+    }
+
+    // Get the parent node, nullptr for the root
+    scene_node* parent() const {
+        return m_parent;
+    }
+
+    // Get the child nodes in drawing order
+    const std::vector<std::unique_ptr<scene_node>>& children() const {
+        return m_children;
+    }
+
+  private:
+    friend class scene;
+
+    // Flag this node and its ancestors as having a change below them. Stops at the first ancestor already flagged.
+    void propagate();
+
+    std::shared_ptr<shape> m_item;
+    scene_node* m_parent;
+    std::vector<std::unique_ptr<scene_node>> m_children;
+    int16_t m_x;
+    int16_t m_y;
+    bool m_visible;
+    bool m_dirty;           // the node's own shape changed
+    bool m_moved;           // the node moved or changed visibility, so its whole subtree is placed again
+    bool m_subtree_dirty;   // something at or below the node changed
+    rect m_drawn;           // display area of the shape when it was last rendered
+    rect m_subtree;         // display area of the node and all of its children when last rendered
+    rect m_removed;         // area of children removed since the last render
+    uint32_t m_revision;    // revision of the shape when it was last collected
+};
+
+};  // namespace graphics
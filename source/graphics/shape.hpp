@@ -4,6 +4,8 @@
 
 #include "canvas.hpp"
 #include "origin.hpp"
+#include "rect.hpp"
+#include <cstdint>
 
 namespace graphics
 {
@@ -15,13 +17,45 @@ class shape {
   public:
     // Create a new shape
     shape(const origin& origin)
-        : m_origin(origin) { }
+        : m_origin(origin)
+        , m_revision(0) { }
+
+    virtual ~shape() = default;
 
     // Draw a shape on the canvas
     virtual void draw(canvas& canvas) = 0;
 
+    // Get the area the shape draws into. Shapes that cannot tell report an area covering the whole display.
+    virtual rect bounds() const {
+        return rect{0, 0, UINT16_MAX, UINT16_MAX};
+    }
+
+    // Move the shape
+    void set_origin(const origin& origin) {
+        m_origin = origin;
+        touch();
+    }
+
+    // Get the shape position
+    const origin& get_origin() const {
+        return m_origin;
+    }
+
+    // Get the number of times the shape has changed. Cached renderings compare this to know when to redraw.
+    uint32_t revision() const {
+        return m_revision;
+    }
+
   protected:
+    // Mark the shape as changed. Called by anything that changes how the shape draws.
+    void touch() {
+        m_revision++;
+    }
+
     origin m_origin;
+
+  private:
+    uint32_t m_revision;
 };
 
 };  // namespace graphics
\ No newline at end of file
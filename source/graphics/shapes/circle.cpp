@@ -0,0 +1,151 @@
+// RGB LED Matrix Graphics Library
+
+#include "circle.hpp"
+#include "math_utilities.hpp"
+#include <algorithm>
+#include <array>
+
+namespace graphics
+{
+// Fixed point scale of the sine table
+constexpr int trig_scale = 1024;
+
+// Sine of each whole degree scaled by trig_scale, generated at compile time
+constexpr std::array<int16_t, 360> make_sin_table() {
+    std::array<int16_t, 360> table{};
+    for ( int angle = 0; angle < 360; angle++ ) {
+        table[angle] = static_cast<int16_t>(math_helpers::round(math_helpers::sin(angle * math_helpers::pi / 180.0) * trig_scale));
+    }
+    return table;
+}
+
+constexpr auto sin_table = make_sin_table();
+
+// Wrap an angle in degrees into [0, 360)
+constexpr int wrap_angle(int angle) {
+    return ((angle % 360) + 360) % 360;
+}
+
+//-----------------------------------------------------------------------------
+std::vector<int> circle_half_widths(int radius) {
+    std::vector<int> half_widths(std::max(radius, 0) + 1, 0);
+    int x = radius;
+    int y = 0;
+    int error = 1 - radius;
+    while ( x >= y ) {
+        half_widths[y] = std::max(half_widths[y], x);
+        half_widths[x] = std::max(half_widths[x], y);
+        y++;
+        if ( error < 0 ) {
+            error += 2 * y + 1;
+        } else {
+            x--;
+            error += 2 * (y - x) + 1;
+        }
+    }
+    return half_widths;
+}
+
+//-----------------------------------------------------------------------------
+circle::circle(const origin& center, int radius, const pixel& color, bool filled)
+    : span_shape(center, color)
+    , m_radius(radius)
+    , m_filled(filled) {
+    rasterize();
+}
+
+//-----------------------------------------------------------------------------
+void circle::set_radius(int radius) {
+    m_radius = radius;
+    rasterize();
+    touch();
+}
+
+//-----------------------------------------------------------------------------
+void circle::rasterize() {
+    m_spans.clear();
+    if ( m_radius < 0 ) {
+        return;
+    }
+
+    auto half_widths = circle_half_widths(m_radius);
+    std::vector<row_extent> rows(2 * m_radius + 1);
+    for ( int dy = -m_radius; dy <= m_radius; dy++ ) {
+        auto half_width = static_cast<int16_t>(half_widths[std::abs(dy)]);
+        rows[dy + m_radius] = row_extent{static_cast<int16_t>(-half_width), half_width};
+    }
+    add_rows(-m_radius, rows, m_filled);
+}
+
+//-----------------------------------------------------------------------------
+arc::arc(const origin& center, int radius, int start_angle, int end_angle, const pixel& color)
+    : span_shape(center, color)
+    , m_radius(radius)
+    , m_start_angle(start_angle)
+    , m_end_angle(end_angle) {
+    rasterize();
+}
+
+//-----------------------------------------------------------------------------
+void arc::set_angles(int start_angle, int end_angle) {
+    m_start_angle = start_angle;
+    m_end_angle = end_angle;
+    rasterize();
+    touch();
+}
+
+//-----------------------------------------------------------------------------
+void arc::rasterize() {
+    m_spans.clear();
+    if ( m_radius < 0 ) {
+        return;
+    }
+
+    // direction vectors of the arc end points. With +Y pointing down, a positive cross product
+    // means the second vector is clockwise of the first.
+    auto start = wrap_angle(m_start_angle);
+    auto end = wrap_angle(m_end_angle);
+    auto sweep = wrap_angle(end - start);
+    int start_x = sin_table[wrap_angle(start + 90)];
+    int start_y = sin_table[start];
+    int end_x = sin_table[wrap_angle(end + 90)];
+    int end_y = sin_table[end];
+    auto in_sector = [&](int x, int y) {
+        auto after_start = (start_x * y - start_y * x) >= 0;
+        auto before_end = (x * end_y - y * end_x) >= 0;
+        if ( (sweep == 0) && (m_start_angle != m_end_angle) ) {
+            return true;
+        }
+        return (sweep <= 180) ? (after_start && before_end) : (after_start || before_end);
+    };
+
+    // walk one octant of the midpoint circle and mirror it into the other seven
+    std::vector<point> points;
+    int x = m_radius;
+    int y = 0;
+    int error = 1 - m_radius;
+    while ( x >= y ) {
+        const int octants[8][2] = {{x, y}, {y, x}, {-y, x}, {-x, y}, {-x, -y}, {-y, -x}, {y, -x}, {x, -y}};
+        for ( auto& [px, py] : octants ) {
+            if ( in_sector(px, py) ) {
+                points.push_back(point{static_cast<int16_t>(px), static_cast<int16_t>(py)});
+            }
+        }
+        y++;
+        if ( error < 0 ) {
+            error += 2 * y + 1;
+        } else {
+            x--;
+            error += 2 * (y - x) + 1;
+        }
+    }
+
+    // order the points by row so that neighbours merge into spans
+    std::sort(points.begin(), points.end(), [](auto& a, auto& b) { return (a.y < b.y) || ((a.y == b.y) && (a.x < b.x)); });
+    points.erase(std::unique(points.begin(), points.end(), [](auto& a, auto& b) { return (a.x == b.x) && (a.y == b.y); }), points.end());
+    for ( auto& p : points ) {
+        add_span(p.x, p.y, 1);
+    }
+}
+
+};  // namespace graphics
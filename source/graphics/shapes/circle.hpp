@@ -0,0 +1,70 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "span_shape.hpp"
+#include <vector>
+
+namespace graphics
+{
+
+/**
+ * \brief horizontal half-width of each row of a circle from its centre row outwards, computed with the
+ *        integer midpoint circle algorithm
+ *
+ * \param radius circle radius
+ * \retval std::vector<int> radius + 1 half-widths
+ */
+std::vector<int> circle_half_widths(int radius);
+
+// Circle centred on the origin
+class circle : public span_shape {
+  public:
+    /**
+     * \brief Construct a new circle
+     *
+     * \param center centre of the circle
+     * \param radius radius in pixels
+     * \param color circle color
+     * \param filled fill the circle, otherwise only the outline is drawn
+     */
+    circle(const origin& center, int radius, const pixel& color, bool filled = false);
+
+    // Change the radius
+    void set_radius(int radius);
+
+  protected:
+    void rasterize() override;
+
+  private:
+    int m_radius;
+    bool m_filled;
+};
+
+// Circular arc centred on the origin. Angles are in degrees, clockwise from the +X axis.
+class arc : public span_shape {
+  public:
+    /**
+     * \brief Construct a new arc
+     *
+     * \param center centre of the arc's circle
+     * \param radius radius in pixels
+     * \param start_angle angle the arc starts at
+     * \param end_angle angle the arc ends at, moving clockwise from the start
+     * \param color arc color
+     */
+    arc(const origin& center, int radius, int start_angle, int end_angle, const pixel& color);
+
+    // Change the angles the arc spans
+    void set_angles(int start_angle, int end_angle);
+
+  protected:
+    void rasterize() override;
+
+  private:
+    int m_radius;
+    int m_start_angle;
+    int m_end_angle;
+};
+
+};  // namespace graphics
@@ -0,0 +1,60 @@
+// RGB LED Matrix Graphics Library
+
+#include "line.hpp"
+#include <algorithm>
+#include <cstdlib>
+
+namespace graphics
+{
+//-----------------------------------------------------------------------------
+line::line(const origin& origin, const point& start, const point& end, const pixel& color)
+    : span_shape(origin, color)
+    , m_start(start)
+    , m_end(end) {
+    rasterize();
+}
+
+//-----------------------------------------------------------------------------
+void line::set_points(const point& start, const point& end) {
+    m_start = start;
+    m_end = end;
+    rasterize();
+    touch();
+}
+
+//-----------------------------------------------------------------------------
+void line::rasterize() {
+    m_spans.clear();
+
+    int x = m_start.x;
+    int y = m_start.y;
+    int dx = std::abs(m_end.x - m_start.x);
+    int dy = -std::abs(m_end.y - m_start.y);
+    int step_x = (m_start.x < m_end.x) ? 1 : -1;
+    int step_y = (m_start.y < m_end.y) ? 1 : -1;
+    int error = dx + dy;
+
+    // runs of pixels on the same row are collected into a single span
+    int run_start = x;
+    while ( true ) {
+        if ( (x == m_end.x) && (y == m_end.y) ) {
+            break;
+        }
+        int doubled_error = 2 * error;
+        if ( doubled_error >= dy ) {
+            error += dy;
+            x += step_x;
+        }
+        if ( doubled_error <= dx ) {
+            // row changes: flush the run ending at the previous pixel
+            int previous_x = (doubled_error >= dy) ? x - step_x : x;
+            add_span(std::min(run_start, previous_x), y, std::abs(previous_x - run_start) + 1);
+            error += dx;
+            y += step_y;
+            run_start = x;
+        }
+    }
+    add_span(std::min(run_start, x), y, std::abs(x - run_start) + 1);
+}
+
+};  // namespace graphics
@@ -0,0 +1,34 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "span_shape.hpp"
+
+namespace graphics
+{
+
+// Straight line between two points, rasterized with Bresenham's algorithm
+class line : public span_shape {
+  public:
+    /**
+     * \brief Construct a new line
+     *
+     * \param origin position of the line
+     * \param start start point relative to the origin
+     * \param end end point relative to the origin
+     * \param color line color
+     */
+    line(const origin& origin, const point& start, const point& end, const pixel& color);
+
+    // Move the end points of the line
+    void set_points(const point& start, const point& end);
+
+  protected:
+    void rasterize() override;
+
+  private:
+    point m_start;
+    point m_end;
+};
+
+};  // namespace graphics
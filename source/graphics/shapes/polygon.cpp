@@ -0,0 +1,96 @@
+// RGB LED Matrix Graphics Library
+
+#include "polygon.hpp"
+#include <algorithm>
+#include <cstdint>
+
+namespace graphics
+{
+// Intersections are tracked as 16.16 fixed point values
+constexpr int fixed_shift = 16;
+constexpr int64_t fixed_one = int64_t{1} << fixed_shift;
+constexpr int64_t fixed_half = fixed_one / 2;
+
+// Polygon edge oriented from top to bottom. Vertices are on whole pixels, so the edge crosses the centre
+// of every row from its upper vertex's row up to, but not including, its lower vertex's row.
+struct edge {
+    int top;         // first row crossed
+    int bottom;      // one past the last row crossed
+    int64_t x;       // x intersection at the centre of the current row
+    int64_t step;    // change in x per row
+};
+
+//-----------------------------------------------------------------------------
+polygon::polygon(const origin& origin, const std::vector<point>& vertices, const pixel& color)
+    : span_shape(origin, color)
+    , m_vertices(vertices) {
+    rasterize();
+}
+
+//-----------------------------------------------------------------------------
+void polygon::set_vertices(const std::vector<point>& vertices) {
+    m_vertices = vertices;
+    rasterize();
+    touch();
+}
+
+//-----------------------------------------------------------------------------
+void polygon::rasterize() {
+    m_spans.clear();
+    if ( m_vertices.size() < 3 ) {
+        return;
+    }
+
+    // build the edge table, skipping horizontal edges which never cross a row centre
+    std::vector<edge> edges;
+    for ( std::size_t i = 0; i < m_vertices.size(); i++ ) {
+        auto a = m_vertices[i];
+        auto b = m_vertices[(i + 1) % m_vertices.size()];
+        if ( a.y == b.y ) {
+            continue;
+        }
+        if ( a.y > b.y ) {
+            std::swap(a, b);
+        }
+
+        // intersection at the first row centre, half a row below the upper vertex
+        int64_t dx = int64_t{b.x} - a.x;
+        int64_t dy = int64_t{b.y} - a.y;
+        int64_t x = int64_t{a.x} * fixed_one + (dx * fixed_one) / (2 * dy);
+        edges.push_back(edge{a.y, b.y, x, (dx * fixed_one) / dy});
+    }
+    if ( edges.empty() ) {
+        return;
+    }
+    std::sort(edges.begin(), edges.end(), [](auto& a, auto& b) { return a.top < b.top; });
+
+    int first_row = edges.front().top;
+    int last_row = std::max_element(edges.begin(), edges.end(), [](auto& a, auto& b) { return a.bottom < b.bottom; })->bottom;
+
+    // sweep the rows keeping a list of the active edges
+    std::vector<edge> active;
+    std::vector<int64_t> crossings;
+    std::size_t next_edge = 0;
+    for ( int y = first_row; y < last_row; y++ ) {
+        while ( (next_edge < edges.size()) && (edges[next_edge].top <= y) ) {
+            active.push_back(edges[next_edge++]);
+        }
+        active.erase(std::remove_if(active.begin(), active.end(), [y](auto& e) { return e.bottom <= y; }), active.end());
+
+        crossings.clear();
+        for ( auto& e : active ) {
+            crossings.push_back(e.x);
+            e.x += e.step;
+        }
+        std::sort(crossings.begin(), crossings.end());
+
+        // fill pixels whose centre lies between each pair of crossings
+        for ( std::size_t i = 0; i + 1 < crossings.size(); i += 2 ) {
+            auto start = static_cast<int>((crossings[i] - fixed_half + fixed_one - 1) >> fixed_shift);
+            auto end = static_cast<int>((crossings[i + 1] - fixed_half + fixed_one - 1) >> fixed_shift);
+            add_span(start, y, end - start);
+        }
+    }
+}
+
+};  // namespace graphics
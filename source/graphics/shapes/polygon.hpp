@@ -0,0 +1,34 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "span_shape.hpp"
+#include <vector>
+
+namespace graphics
+{
+
+// Filled polygon rasterized with a scanline filler using the even-odd rule. Pixels are filled when their
+// centre lies inside the polygon, so polygons sharing an edge never overlap.
+class polygon : public span_shape {
+  public:
+    /**
+     * \brief Construct a new polygon
+     *
+     * \param origin position of the polygon
+     * \param vertices vertices relative to the origin. The last vertex connects back to the first.
+     * \param color fill color
+     */
+    polygon(const origin& origin, const std::vector<point>& vertices, const pixel& color);
+
+    // Replace the vertices
+    void set_vertices(const std::vector<point>& vertices);
+
+  protected:
+    void rasterize() override;
+
+  private:
+    std::vector<point> m_vertices;
+};
+
+};  // namespace graphics
@@ -0,0 +1,78 @@
+// RGB LED Matrix Graphics Library
+
+#include "rectangle.hpp"
+#include "circle.hpp"
+#include <algorithm>
+
+namespace graphics
+{
+//-----------------------------------------------------------------------------
+rectangle::rectangle(const origin& origin, int width, int height, const pixel& color, bool filled)
+    : span_shape(origin, color)
+    , m_width(width)
+    , m_height(height)
+    , m_filled(filled) {
+    rasterize();
+}
+
+//-----------------------------------------------------------------------------
+void rectangle::set_size(int width, int height) {
+    m_width = width;
+    m_height = height;
+    rasterize();
+    touch();
+}
+
+//-----------------------------------------------------------------------------
+void rectangle::rasterize() {
+    m_spans.clear();
+    for ( int y = 0; y < m_height; y++ ) {
+        if ( m_filled || (y == 0) || (y == m_height - 1) || (m_width <= 2) ) {
+            add_span(0, y, m_width);
+        } else {
+            add_span(0, y, 1);
+            add_span(m_width - 1, y, 1);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+rounded_rectangle::rounded_rectangle(const origin& origin, int width, int height, int radius, const pixel& color, bool filled)
+    : span_shape(origin, color)
+    , m_width(width)
+    , m_height(height)
+    , m_radius(radius)
+    , m_filled(filled) {
+    rasterize();
+}
+
+//-----------------------------------------------------------------------------
+void rounded_rectangle::set_size(int width, int height, int radius) {
+    m_width = width;
+    m_height = height;
+    m_radius = radius;
+    rasterize();
+    touch();
+}
+
+//-----------------------------------------------------------------------------
+void rounded_rectangle::rasterize() {
+    m_spans.clear();
+    if ( (m_width <= 0) || (m_height <= 0) ) {
+        return;
+    }
+
+    auto radius = std::clamp(m_radius, 0, (std::min(m_width, m_height) - 1) / 2);
+    auto half_widths = circle_half_widths(radius);
+
+    std::vector<row_extent> rows(m_height);
+    for ( int y = 0; y < m_height; y++ ) {
+        // distance of the row into the top or bottom corner band, measured from the corner circle centre
+        int band = (y < radius) ? (radius - y) : ((y > m_height - 1 - radius) ? (y - (m_height - 1 - radius)) : 0);
+        int inset = radius - half_widths[band];
+        rows[y] = row_extent{static_cast<int16_t>(inset), static_cast<int16_t>(m_width - 1 - inset)};
+    }
+    add_rows(0, rows, m_filled);
+}
+
+};  // namespace graphics
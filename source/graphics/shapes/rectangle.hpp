@@ -0,0 +1,64 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "span_shape.hpp"
+
+namespace graphics
+{
+
+// Axis aligned rectangle with its top-left corner at the origin
+class rectangle : public span_shape {
+  public:
+    /**
+     * \brief Construct a new rectangle
+     *
+     * \param origin top-left corner of the rectangle
+     * \param width width in pixels
+     * \param height height in pixels
+     * \param color rectangle color
+     * \param filled fill the rectangle, otherwise only the outline is drawn
+     */
+    rectangle(const origin& origin, int width, int height, const pixel& color, bool filled = false);
+
+    // Resize the rectangle
+    void set_size(int width, int height);
+
+  protected:
+    void rasterize() override;
+
+  private:
+    int m_width;
+    int m_height;
+    bool m_filled;
+};
+
+// Rectangle with corners rounded off by quarter circles
+class rounded_rectangle : public span_shape {
+  public:
+    /**
+     * \brief Construct a new rounded rectangle
+     *
+     * \param origin top-left corner of the rectangle
+     * \param width width in pixels
+     * \param height height in pixels
+     * \param radius corner radius in pixels, limited to half of the smaller side
+     * \param color rectangle color
+     * \param filled fill the rectangle, otherwise only the outline is drawn
+     */
+    rounded_rectangle(const origin& origin, int width, int height, int radius, const pixel& color, bool filled = false);
+
+    // Resize the rectangle
+    void set_size(int width, int height, int radius);
+
+  protected:
+    void rasterize() override;
+
+  private:
+    int m_width;
+    int m_height;
+    int m_radius;
+    bool m_filled;
+};
+
+};  // namespace graphics
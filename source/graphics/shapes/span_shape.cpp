@@ -0,0 +1,67 @@
+// RGB LED Matrix Graphics Library
+
+#include "span_shape.hpp"
+#include <algorithm>
+
+namespace graphics
+{
+//-----------------------------------------------------------------------------
+span_shape::span_shape(const origin& origin, const pixel& color)
+    : shape(origin)
+    , m_color(color) { }
+
+//-----------------------------------------------------------------------------
+void span_shape::draw(canvas& canvas) {
+    for ( const auto& span : m_spans ) {
+        canvas.fill_span(m_origin.x + span.x, m_origin.y + span.y, span.length, m_color);
+    }
+}
+
+//-----------------------------------------------------------------------------
+rect span_shape::bounds() const {
+    rect area{0, 0, 0, 0};
+    for ( const auto& span : m_spans ) {
+        area = unite(area, rect{static_cast<int16_t>(m_origin.x + span.x), static_cast<int16_t>(m_origin.y + span.y), span.length, 1});
+    }
+    return area;
+}
+
+//-----------------------------------------------------------------------------
+void span_shape::add_span(int x, int y, int length) {
+    if ( length <= 0 ) {
+        return;
+    }
+
+    if ( !m_spans.empty() ) {
+        auto& last = m_spans.back();
+        if ( (last.y == y) && (last.x + last.length == x) ) {
+            last.length = static_cast<uint16_t>(last.length + length);
+            return;
+        }
+    }
+    m_spans.push_back(span{static_cast<int16_t>(x), static_cast<int16_t>(y), static_cast<uint16_t>(length)});
+}
+
+//-----------------------------------------------------------------------------
+void span_shape::add_rows(int top, const std::vector<row_extent>& rows, bool filled) {
+    auto count = static_cast<int>(rows.size());
+    for ( int i = 0; i < count; i++ ) {
+        auto [left, right] = rows[i];
+        if ( filled || (i == 0) || (i == count - 1) ) {
+            add_span(left, top + i, right - left + 1);
+            continue;
+        }
+
+        // a pixel is on the boundary unless it has neighbours on all four sides
+        int inner_left = std::max({left + 1, static_cast<int>(rows[i - 1].left), static_cast<int>(rows[i + 1].left)});
+        int inner_right = std::min({right - 1, static_cast<int>(rows[i - 1].right), static_cast<int>(rows[i + 1].right)});
+        if ( inner_left > inner_right ) {
+            add_span(left, top + i, right - left + 1);
+        } else {
+            add_span(left, top + i, inner_left - left);
+            add_span(inner_right + 1, top + i, right - inner_right);
+        }
+    }
+}
+
+};  // namespace graphics
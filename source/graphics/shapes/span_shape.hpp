@@ -0,0 +1,91 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "canvas.hpp"
+#include "pixel.hpp"
+#include "shape.hpp"
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace graphics
+{
+
+// Offset of a point relative to a shape's origin
+struct point {
+    int16_t x;
+    int16_t y;
+};
+
+// Horizontal run of pixels relative to a shape's origin
+struct span {
+    int16_t x;
+    int16_t y;
+    uint16_t length;
+};
+
+// Inclusive horizontal extent of a single row of a shape
+struct row_extent {
+    int16_t left;
+    int16_t right;
+};
+
+// Base class for shapes that are rasterized into a list of horizontal spans whenever their geometry changes.
+// Drawing replays the spans at the shape's origin, so moving or recoloring a shape never re-rasterizes it.
+class span_shape : public shape {
+  public:
+    /**
+     * \brief Construct a new span shape
+     *
+     * \param origin position of the shape
+     * \param color color to draw the shape with
+     */
+    span_shape(const origin& origin, const pixel& color);
+
+    // Draw the shape on the canvas
+    void draw(canvas& canvas) override;
+
+    // Get the area covered by the spans
+    rect bounds() const override;
+
+    // Change the color of the shape
+    void set_color(const pixel& color) {
+        m_color = color;
+        touch();
+    }
+
+    // Get the rasterized spans
+    const std::vector<span>& spans() const {
+        return m_spans;
+    }
+
+  protected:
+    /**
+     * \brief rebuild the span list from the current geometry. Called by derived classes whenever their geometry changes.
+     */
+    virtual void rasterize() = 0;
+
+    /**
+     * \brief add a span, merging it with the previous span if they are contiguous on the same row
+     *
+     * \param x start of the span
+     * \param y row of the span
+     * \param length number of pixels
+     */
+    void add_span(int x, int y, int length);
+
+    /**
+     * \brief add the spans for a shape described by the horizontal extent of each of its rows. Used by convex shapes.
+     *
+     * \param top row of the first extent
+     * \param rows extent of each row from the top down
+     * \param filled fill the rows, otherwise only the boundary pixels are added
+     */
+    void add_rows(int top, const std::vector<row_extent>& rows, bool filled);
+
+    std::vector<span> m_spans;
+    pixel m_color;
+};
+
+};  // namespace graphics
@@ -0,0 +1,39 @@
+// RGB LED Matrix Graphics Library
+
+#include "sprite.hpp"
+
+namespace graphics
+{
+//-----------------------------------------------------------------------------
+sprite::sprite(const origin& origin, const sprite_view& view)
+    : shape(origin)
+    , m_view(view)
+    , m_frame(0) { }
+
+//-----------------------------------------------------------------------------
+void sprite::draw(canvas& canvas) {
+    auto pixels = m_view.frame_pixels(m_frame);
+    auto mask = m_view.frame_mask(m_frame);
+    for ( int row = 0; row < m_view.height; row++ ) {
+        canvas.blit_row(m_origin.x, m_origin.y + row, pixels, m_view.width, mask);
+        pixels += m_view.width;
+        if ( mask != nullptr ) {
+            mask += m_view.mask_stride();
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+void sprite::set_frame(int frame) {
+    // wrap negative frames too so stepping backwards never reads before the sheet
+    int count = m_view.frame_count;
+    m_frame = (count > 0) ? ((frame % count) + count) % count : 0;
+    touch();
+}
+
+//-----------------------------------------------------------------------------
+void sprite::next_frame() {
+    set_frame(m_frame + 1);
+}
+
+};  // namespace graphics
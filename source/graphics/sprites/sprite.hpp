@@ -0,0 +1,46 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "shape.hpp"
+#include "sprite_sheet.hpp"
+
+namespace graphics
+{
+
+// Shape that draws one frame of a sprite straight out of a mapped sprite sheet
+class sprite : public shape {
+  public:
+    /**
+     * \brief Construct a new sprite
+     *
+     * \param origin top-left corner of the sprite
+     * \param view the sprite to draw. The sheet it came from must outlive the shape.
+     */
+    sprite(const origin& origin, const sprite_view& view);
+
+    // Draw the current frame on the canvas
+    void draw(canvas& canvas) override;
+
+    // Get the area covered by a frame of the sprite
+    rect bounds() const override {
+        return rect{static_cast<int16_t>(m_origin.x), static_cast<int16_t>(m_origin.y), m_view.width, m_view.height};
+    }
+
+    // Select the frame to draw. Wraps around at the frame count.
+    void set_frame(int frame);
+
+    // Advance to the next frame of the animation
+    void next_frame();
+
+    // Get the current frame index
+    int frame() const {
+        return m_frame;
+    }
+
+  private:
+    sprite_view m_view;
+    int m_frame;
+};
+
+};  // namespace graphics
@@ -0,0 +1,126 @@
+// RGB LED Matrix Graphics Library
+
+#include "sprite_sheet.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+
+namespace graphics
+{
+// Get the name of a sprite entry without its null padding
+static std::string_view entry_name(const sprite_entry& entry) {
+    return std::string_view{entry.name, strnlen(entry.name, sprite_name_length)};
+}
+
+// Check that a section of the file lies inside the mapping and is aligned for in-place access
+static bool section_is_valid(std::size_t file_size, uint32_t offset, std::size_t length) {
+    return (offset % alignof(packed_pixel) == 0) && (offset <= file_size) && (length <= file_size - offset);
+}
+
+//-----------------------------------------------------------------------------
+expected<sprite_sheet, std::string> sprite_sheet::load_from_path(const std::string& path) {
+    auto file = ::open(path.c_str(), O_RDONLY);
+    if ( file < 0 ) {
+        return expected<sprite_sheet, std::string>::error("Could not open sprite sheet " + path);
+    }
+
+    struct stat status;
+    if ( (::fstat(file, &status) != 0) || (static_cast<std::size_t>(status.st_size) < sizeof(sprite_sheet_header)) ) {
+        ::close(file);
+        return expected<sprite_sheet, std::string>::error("Sprite sheet is too small to be valid");
+    }
+
+    auto size = static_cast<std::size_t>(status.st_size);
+    auto mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE | MAP_POPULATE, file, 0);
+    ::close(file);
+    if ( mapping == MAP_FAILED ) {
+        return expected<sprite_sheet, std::string>::error("Could not map sprite sheet " + path);
+    }
+
+    // the sheet owns the mapping from here on, so any validation failure unmaps it
+    sprite_sheet sheet{static_cast<const uint8_t*>(mapping), size};
+    auto header = reinterpret_cast<const sprite_sheet_header*>(sheet.m_data);
+    if ( (header->magic != sprite_sheet_magic) || (header->version != sprite_sheet_version) ) {
+        return expected<sprite_sheet, std::string>::error("Invalid sprite sheet header");
+    }
+
+    if ( !section_is_valid(size, sizeof(sprite_sheet_header), static_cast<std::size_t>(header->sprite_count) * sizeof(sprite_entry)) ) {
+        return expected<sprite_sheet, std::string>::error("Sprite table is truncated");
+    }
+
+    auto entries = reinterpret_cast<const sprite_entry*>(sheet.m_data + sizeof(sprite_sheet_header));
+    for ( uint32_t i = 0; i < header->sprite_count; i++ ) {
+        auto& entry = entries[i];
+        if ( entry.frame_count == 0 ) {
+            return expected<sprite_sheet, std::string>::error("Sprite has no frames");
+        }
+        // find() binary searches the table, so names must be unique and in order
+        if ( (i > 0) && !(entry_name(entries[i - 1]) < entry_name(entry)) ) {
+            return expected<sprite_sheet, std::string>::error("Sprite table is not sorted by name");
+        }
+        auto pixels = static_cast<std::size_t>(entry.width) * entry.height * entry.frame_count;
+        auto mask = static_cast<std::size_t>((entry.width + 7) / 8) * entry.height * entry.frame_count;
+        if ( !section_is_valid(size, entry.pixel_offset, pixels * sizeof(packed_pixel)) ||
+             ((entry.mask_offset != 0) && !section_is_valid(size, entry.mask_offset, mask)) ) {
+            return expected<sprite_sheet, std::string>::error("Sprite data is out of range");
+        }
+    }
+
+    return expected<sprite_sheet, std::string>::success(std::move(sheet));
+}
+
+//-----------------------------------------------------------------------------
+sprite_sheet::sprite_sheet(const uint8_t* data, std::size_t size)
+    : m_data(data)
+    , m_size(size) { }
+
+//-----------------------------------------------------------------------------
+sprite_sheet::sprite_sheet(sprite_sheet&& other)
+    : m_data(std::exchange(other.m_data, nullptr))
+    , m_size(std::exchange(other.m_size, 0)) { }
+
+//-----------------------------------------------------------------------------
+sprite_sheet& sprite_sheet::operator=(sprite_sheet&& other) {
+    std::swap(m_data, other.m_data);
+    std::swap(m_size, other.m_size);
+    return *this;
+}
+
+//-----------------------------------------------------------------------------
+sprite_sheet::~sprite_sheet() {
+    if ( m_data != nullptr ) {
+        ::munmap(const_cast<uint8_t*>(m_data), m_size);
+    }
+}
+
+//-----------------------------------------------------------------------------
+std::size_t sprite_sheet::size() const {
+    return reinterpret_cast<const sprite_sheet_header*>(m_data)->sprite_count;
+}
+
+//-----------------------------------------------------------------------------
+std::optional<sprite_view> sprite_sheet::find(std::string_view name) const {
+    auto entries = reinterpret_cast<const sprite_entry*>(m_data + sizeof(sprite_sheet_header));
+    auto end = entries + size();
+    auto match = std::lower_bound(entries, end, name, [](const sprite_entry& entry, std::string_view key) { return entry_name(entry) < key; });
+    if ( (match == end) || (entry_name(*match) != name) ) {
+        return {};
+    }
+    return at(static_cast<std::size_t>(match - entries));
+}
+
+//-----------------------------------------------------------------------------
+sprite_view sprite_sheet::at(std::size_t index) const {
+    auto& entry = reinterpret_cast<const sprite_entry*>(m_data + sizeof(sprite_sheet_header))[index];
+    return sprite_view{entry.width,
+                       entry.height,
+                       entry.frame_count,
+                       reinterpret_cast<const packed_pixel*>(m_data + entry.pixel_offset),
+                       (entry.mask_offset != 0) ? m_data + entry.mask_offset : nullptr};
+}
+
+};  // namespace graphics
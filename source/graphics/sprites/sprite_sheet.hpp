@@ -0,0 +1,118 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "expected.hpp"
+#include "pixel.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace graphics
+{
+
+// On-disk sprite sheet layout. All values are little endian and every section is 4-byte aligned so that
+// pixel data can be used in place straight out of the file mapping. Files are produced by scripts/sprite_packer.py.
+//
+//  sprite_sheet_header
+//  sprite_entry[sprite_count]          sorted by name
+//  pixel and mask data
+//
+// Each sprite's pixels are frame_count frames of height rows of width packed pixels (0x00RRGGBB). The optional
+// mask is frame_count frames of height rows of (width + 7) / 8 bytes, most significant bit first, 1 = opaque.
+constexpr uint32_t sprite_sheet_magic = 0x5350524C;  // file starts with the bytes "LRPS"
+constexpr uint16_t sprite_sheet_version = 1;
+constexpr std::size_t sprite_name_length = 32;
+
+struct sprite_sheet_header {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t flags;
+    uint32_t sprite_count;
+    uint32_t reserved;
+};
+
+struct sprite_entry {
+    char name[sprite_name_length];  // null padded
+    uint16_t width;
+    uint16_t height;
+    uint16_t frame_count;
+    uint16_t flags;
+    uint32_t pixel_offset;          // offset of the first frame from the start of the file
+    uint32_t mask_offset;           // offset of the first mask frame, 0 if the sprite has no mask
+};
+
+static_assert(sizeof(sprite_sheet_header) == 16, "sprite sheet header must match the file format");
+static_assert(sizeof(sprite_entry) == 48, "sprite entry must match the file format");
+
+// Read-only view of a single sprite inside a mapped sheet
+struct sprite_view {
+    uint16_t width;
+    uint16_t height;
+    uint16_t frame_count;
+    const packed_pixel* pixels;
+    const uint8_t* mask;  // nullptr if the sprite has no mask
+
+    // Bytes per mask row
+    int mask_stride() const {
+        return (width + 7) / 8;
+    }
+
+    // First pixel row of a frame
+    const packed_pixel* frame_pixels(int frame) const {
+        return pixels + static_cast<std::size_t>(frame) * width * height;
+    }
+
+    // First mask row of a frame, nullptr if the sprite has no mask
+    const uint8_t* frame_mask(int frame) const {
+        return (mask != nullptr) ? mask + static_cast<std::size_t>(frame) * mask_stride() * height : nullptr;
+    }
+};
+
+// Collection of sprites loaded with a single read-only memory mapping. Sprite pixel data is never copied.
+class sprite_sheet {
+  public:
+    /**
+     * \brief Factory method to map a sprite sheet file
+     *
+     * \param path path to the sprite sheet file
+     * \retval expected<sprite_sheet, std::string>
+     */
+    static expected<sprite_sheet, std::string> load_from_path(const std::string& path);
+
+    // Sheets own their mapping so they can be moved but not copied
+    sprite_sheet(const sprite_sheet& other) = delete;
+    sprite_sheet& operator=(const sprite_sheet& other) = delete;
+    sprite_sheet(sprite_sheet&& other);
+    sprite_sheet& operator=(sprite_sheet&& other);
+    ~sprite_sheet();
+
+    // Number of sprites in the sheet
+    std::size_t size() const;
+
+    /**
+     * \brief look up a sprite by name
+     *
+     * \param name the sprite name
+     * \retval std::optional<sprite_view> the sprite if it exists
+     */
+    std::optional<sprite_view> find(std::string_view name) const;
+
+    /**
+     * \brief get a sprite by its index in the sheet
+     *
+     * \param index the sprite index
+     * \retval sprite_view
+     */
+    sprite_view at(std::size_t index) const;
+
+  private:
+    sprite_sheet(const uint8_t* data, std::size_t size);
+
+    const uint8_t* m_data;
+    std::size_t m_size;
+};
+
+};  // namespace graphics
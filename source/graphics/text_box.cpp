@@ -7,46 +7,76 @@ namespace graphics
 //-----------------------------------------------------------------------------
 text_box::text_box(const std::vector<fonts::character>& characters,
                    graphics::origin origin,
-                   pixel& color,
+                   const pixel& color,
                    uint8_t width,
                    uint8_t height,
                    horizontal_alignment h_align,
                    vertical_alignment v_align)
     : shape(origin)
-    , characters(characters)
-    , color(color)
-    , width(width)
-    , height(height)
-    , h_align(h_align)
-    , v_align(v_align) { }
+    , m_characters(characters)
+    , m_color(color)
+    , m_width(width)
+    , m_height(height)
+    , m_h_align(h_align)
+    , m_v_align(v_align) { }
+
+//-----------------------------------------------------------------------------
+void text_box::set_text(const std::vector<fonts::character>& characters) {
+    m_characters = characters;
+    touch();
+}
+
+//-----------------------------------------------------------------------------
+void text_box::set_color(const pixel& color) {
+    m_color = color;
+    touch();
+}
+
+//-----------------------------------------------------------------------------
+void text_box::set_size(uint8_t width, uint8_t height) {
+    m_width = width;
+    m_height = height;
+    touch();
+}
+
+//-----------------------------------------------------------------------------
+void text_box::set_alignment(horizontal_alignment h_align, vertical_alignment v_align) {
+    m_h_align = h_align;
+    m_v_align = v_align;
+    touch();
+}
 
 
 //-----------------------------------------------------------------------------
 void text_box::draw(canvas& canvas) {
-    auto char_width = characters[0].properties.b_box.width;
-    auto char_height = characters[0].properties.b_box.height;
-    auto string_width = characters.size() * char_width;
+    if ( m_characters.empty() ) {
+        return;
+    }
+
+    auto char_width = m_characters[0].properties.b_box.width;
+    auto char_height = m_characters[0].properties.b_box.height;
+    auto string_width = m_characters.size() * char_width;
     int x_position = m_origin.x;
     int y_position = m_origin.y;
 
-    if ( string_width < width ) {
-        if ( h_align == horizontal_alignment::center ) {
-            x_position += (width - string_width) / 2;
-        } else if ( h_align == horizontal_alignment::right ) {
-            x_position += (width - string_width);
+    if ( string_width < m_width ) {
+        if ( m_h_align == horizontal_alignment::center ) {
+            x_position += (m_width - string_width) / 2;
+        } else if ( m_h_align == horizontal_alignment::right ) {
+            x_position += (m_width - string_width);
         }
     }
 
-    if ( char_height < height ) {
-        if ( v_align == vertical_alignment::center ) {
-            y_position += (height - char_height) / 2;
-        } else if ( v_align == vertical_alignment::bottom ) {
-            y_position += height - char_height;
+    if ( char_height < m_height ) {
+        if ( m_v_align == vertical_alignment::center ) {
+            y_position += (m_height - char_height) / 2;
+        } else if ( m_v_align == vertical_alignment::bottom ) {
+            y_position += m_height - char_height;
         }
     }
 
-    for ( int character_count = 0; character_count < characters.size(); character_count++ ) {        
-        auto character = characters[character_count];        
+    for ( int character_count = 0; character_count < m_characters.size(); character_count++ ) {        
+        auto character = m_characters[character_count];        
         auto& bbox = character.properties.b_box;
 
         // fonts larger than 8 bits will be encoded as 16-bit values with padding right-aligned
@@ -59,7 +89,7 @@ void text_box::draw(canvas& canvas) {
                 if ( bitmap & (0x01 << (pixel_shift - i)) ) {
                     auto x = x_position + i;
                     auto y = y_position + j;
-                    canvas.set_pixel(x, y, color);
+                    canvas.set_pixel(x, y, m_color);
                 }
             }
         }
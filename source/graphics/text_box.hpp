@@ -9,25 +9,56 @@
 
 namespace graphics
 {
-struct text_box : protected shape {
 
+// Line of bitmapped characters aligned within a box
+class text_box : public shape {
+  public:
+    /**
+     * \brief Construct a new text box
+     *
+     * \param characters encoded characters to draw
+     * \param origin top-left corner of the box
+     * \param color text color
+     * \param width width of the box in pixels
+     * \param height height of the box in pixels
+     * \param h_align horizontal alignment of the text within the box
+     * \param v_align vertical alignment of the text within the box
+     */
     text_box(const std::vector<fonts::character>& characters,
              graphics::origin origin,
-             pixel& color,
+             const pixel& color,
              uint8_t width,
              uint8_t height,
              horizontal_alignment h_align = horizontal_alignment::left,
              vertical_alignment v_align = vertical_alignment::top);
 
     // Draw on the canvas
-    void draw(canvas& canvas);
-
-    std::vector<fonts::character> characters;
-    pixel& color;
-    uint8_t width;
-    uint8_t height;
-    horizontal_alignment h_align;
-    vertical_alignment v_align;
+    void draw(canvas& canvas) override;
+
+    // Get the area of the box
+    rect bounds() const override {
+        return rect{static_cast<int16_t>(m_origin.x), static_cast<int16_t>(m_origin.y), m_width, m_height};
+    }
+
+    // Replace the text
+    void set_text(const std::vector<fonts::character>& characters);
+
+    // Change the text color
+    void set_color(const pixel& color);
+
+    // Resize the box
+    void set_size(uint8_t width, uint8_t height);
+
+    // Change how the text is aligned within the box
+    void set_alignment(horizontal_alignment h_align, vertical_alignment v_align);
+
+  private:
+    std::vector<fonts::character> m_characters;
+    pixel m_color;
+    uint8_t m_width;
+    uint8_t m_height;
+    horizontal_alignment m_h_align;
+    vertical_alignment m_v_align;
 };
 
-};  // namespace graphics
\ No newline at end of file
+};  // namespace graphics
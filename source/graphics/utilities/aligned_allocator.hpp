@@ -0,0 +1,53 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+/**
+ * \brief minimal allocator that returns storage aligned to a fixed boundary so that frame buffer rows can
+ *        be loaded with full width vector instructions
+ *
+ * \tparam T the value type
+ * \tparam Alignment alignment of the storage in bytes. Must be a power of two.
+ */
+template <typename T, std::size_t Alignment = 16>
+struct aligned_allocator {
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = aligned_allocator<U, Alignment>;
+    };
+
+    aligned_allocator() = default;
+
+    template <typename U>
+    aligned_allocator(const aligned_allocator<U, Alignment>&) { }
+
+    T* allocate(std::size_t count) {
+        // std::aligned_alloc requires the size to be a multiple of the alignment
+        auto bytes = ((count * sizeof(T) + Alignment - 1) / Alignment) * Alignment;
+        auto memory = std::aligned_alloc(Alignment, (bytes > 0) ? bytes : Alignment);
+        if ( memory == nullptr ) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(memory);
+    }
+
+    void deallocate(T* memory, std::size_t) {
+        std::free(memory);
+    }
+};
+
+template <typename T, typename U, std::size_t Alignment>
+bool operator==(const aligned_allocator<T, Alignment>&, const aligned_allocator<U, Alignment>&) {
+    return true;
+}
+
+template <typename T, typename U, std::size_t Alignment>
+bool operator!=(const aligned_allocator<T, Alignment>&, const aligned_allocator<U, Alignment>&) {
+    return false;
+}
@@ -0,0 +1,113 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include <cstdint>
+
+// constexpr versions of the few math functions needed to generate lookup tables at compile time.
+// These trade speed for being usable in constant expressions and are not meant for per-pixel use.
+namespace math_helpers
+{
+constexpr double ln_2 = 0.69314718055994530942;
+constexpr double pi = 3.14159265358979323846;
+
+/**
+ * \brief absolute value
+ */
+constexpr double abs(double x) {
+    return (x < 0) ? -x : x;
+}
+
+/**
+ * \brief round to the nearest integer, halves away from zero
+ */
+constexpr int32_t round(double x) {
+    return (x < 0) ? static_cast<int32_t>(x - 0.5) : static_cast<int32_t>(x + 0.5);
+}
+
+/**
+ * \brief exponential function. The argument is halved until the Taylor series converges quickly and
+ *        the result is squared back up.
+ */
+constexpr double exp(double x) {
+    int halvings = 0;
+    while ( abs(x) > 0.5 ) {
+        x /= 2;
+        halvings++;
+    }
+
+    double sum = 1.0;
+    double term = 1.0;
+    for ( int i = 1; i < 20; i++ ) {
+        term *= x / i;
+        sum += term;
+    }
+
+    while ( halvings-- > 0 ) {
+        sum *= sum;
+    }
+    return sum;
+}
+
+/**
+ * \brief natural logarithm of a positive value. The argument is scaled into [0.5, 2] by powers of two and the
+ *        remainder is evaluated with the atanh series.
+ */
+constexpr double log(double x) {
+    int exponent = 0;
+    while ( x > 2.0 ) {
+        x /= 2;
+        exponent++;
+    }
+    while ( x < 0.5 ) {
+        x *= 2;
+        exponent--;
+    }
+
+    double y = (x - 1) / (x + 1);
+    double y_squared = y * y;
+    double term = y;
+    double sum = 0.0;
+    for ( int i = 1; i < 40; i += 2 ) {
+        sum += term / i;
+        term *= y_squared;
+    }
+    return 2 * sum + exponent * ln_2;
+}
+
+/**
+ * \brief raise a non-negative base to a real exponent
+ */
+constexpr double pow(double base, double exponent) {
+    return (base <= 0.0) ? 0.0 : exp(exponent * log(base));
+}
+
+/**
+ * \brief sine of an angle in radians
+ */
+constexpr double sin(double x) {
+    // wrap into [-pi, pi] so the Taylor series converges quickly
+    while ( x > pi ) {
+        x -= 2 * pi;
+    }
+    while ( x < -pi ) {
+        x += 2 * pi;
+    }
+
+    double sum = x;
+    double term = x;
+    for ( int i = 1; i < 12; i++ ) {
+        term *= -x * x / ((2 * i) * (2 * i + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+/**
+ * \brief cosine of an angle in radians
+ */
+constexpr double cos(double x) {
+    return sin(x + pi / 2);
+}
+
+};  // namespace math_helpers
@@ -0,0 +1,71 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * \brief fixed capacity ring buffer that overwrites its oldest element when full. Storage is allocated once
+ *        at construction.
+ *
+ * \tparam T the value type
+ */
+template <typename T>
+class ring_buffer {
+  public:
+    explicit ring_buffer(std::size_t capacity)
+        : m_items(capacity)
+        , m_head(0)
+        , m_size(0) { }
+
+    // Add an item, dropping the oldest one if the buffer is full
+    void push(const T& item) {
+        if ( m_items.empty() ) {
+            return;
+        }
+        m_items[(m_head + m_size) % m_items.size()] = item;
+        if ( m_size < m_items.size() ) {
+            m_size++;
+        } else {
+            m_head = (m_head + 1) % m_items.size();
+        }
+    }
+
+    // Access an item by age, 0 being the oldest
+    const T& operator[](std::size_t index) const {
+        return m_items[(m_head + index) % m_items.size()];
+    }
+
+    // Access the newest item
+    const T& back() const {
+        return (*this)[m_size - 1];
+    }
+
+    // Remove all items
+    void clear() {
+        m_head = 0;
+        m_size = 0;
+    }
+
+    std::size_t size() const {
+        return m_size;
+    }
+
+    std::size_t capacity() const {
+        return m_items.size();
+    }
+
+    bool empty() const {
+        return m_size == 0;
+    }
+
+    bool full() const {
+        return m_size == m_items.size();
+    }
+
+  private:
+    std::vector<T> m_items;
+    std::size_t m_head;
+    std::size_t m_size;
+};
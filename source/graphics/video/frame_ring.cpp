@@ -0,0 +1,65 @@
+// RGB LED Matrix Graphics Library
+
+#include "frame_ring.hpp"
+
+namespace graphics
+{
+//-----------------------------------------------------------------------------
+frame_ring::frame_ring(std::size_t capacity, int width, int height)
+    : m_head(0)
+    , m_count(0)
+    , m_closed(false) {
+    m_frames.reserve(capacity);
+    for ( std::size_t i = 0; i < capacity; i++ ) {
+        m_frames.push_back(timed_frame{framebuffer{width, height}, 0});
+    }
+}
+
+//-----------------------------------------------------------------------------
+timed_frame* frame_ring::acquire() {
+    std::unique_lock<std::mutex> lock{m_mutex};
+    m_space_available.wait(lock, [this]() { return m_closed || (m_count < m_frames.size()); });
+    return m_closed ? nullptr : &m_frames[(m_head + m_count) % m_frames.size()];
+}
+
+//-----------------------------------------------------------------------------
+void frame_ring::commit() {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_count++;
+}
+
+//-----------------------------------------------------------------------------
+const timed_frame* frame_ring::peek(std::size_t index) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return (index < m_count) ? &m_frames[(m_head + index) % m_frames.size()] : nullptr;
+}
+
+//-----------------------------------------------------------------------------
+void frame_ring::pop() {
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        if ( m_count == 0 ) {
+            return;
+        }
+        m_head = (m_head + 1) % m_frames.size();
+        m_count--;
+    }
+    m_space_available.notify_one();
+}
+
+//-----------------------------------------------------------------------------
+std::size_t frame_ring::size() {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_count;
+}
+
+//-----------------------------------------------------------------------------
+void frame_ring::close() {
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_closed = true;
+    }
+    m_space_available.notify_all();
+}
+
+};  // namespace graphics
@@ -0,0 +1,76 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "framebuffer.hpp"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace graphics
+{
+
+// Frame with the time it should be presented at
+struct timed_frame {
+    framebuffer frame;
+    uint64_t timestamp_ms;
+};
+
+// Bounded single producer, single consumer ring of decoded frames. All frames are allocated up front so memory
+// use is fixed by the capacity. The producer blocks when the ring is full; the consumer never blocks.
+class frame_ring {
+  public:
+    /**
+     * \brief Construct a new frame ring
+     *
+     * \param capacity number of frames the ring holds
+     * \param width width of the frames
+     * \param height height of the frames
+     */
+    frame_ring(std::size_t capacity, int width, int height);
+
+    /**
+     * \brief wait for a free slot to decode into
+     *
+     * \retval timed_frame* the slot to fill, or nullptr if the ring was closed while waiting
+     */
+    timed_frame* acquire();
+
+    /**
+     * \brief publish the slot returned by acquire to the consumer
+     */
+    void commit();
+
+    /**
+     * \brief get a ready frame without removing it
+     *
+     * \param index position from the oldest ready frame
+     * \retval const timed_frame* the frame, or nullptr if fewer frames are ready
+     */
+    const timed_frame* peek(std::size_t index = 0);
+
+    /**
+     * \brief release the oldest frame back to the producer
+     */
+    void pop();
+
+    // Number of frames ready for the consumer
+    std::size_t size();
+
+    /**
+     * \brief wake and refuse any producer waiting on a free slot
+     */
+    void close();
+
+  private:
+    std::vector<timed_frame> m_frames;
+    std::size_t m_head;   // oldest frame
+    std::size_t m_count;  // frames ready
+    bool m_closed;
+    std::mutex m_mutex;
+    std::condition_variable m_space_available;
+};
+
+};  // namespace graphics
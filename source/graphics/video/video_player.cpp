@@ -0,0 +1,119 @@
+// RGB LED Matrix Graphics Library
+
+#include "video_player.hpp"
+#include "kernels.hpp"
+
+namespace graphics
+{
+//-----------------------------------------------------------------------------
+video_player::video_player(video_reader&& reader, std::size_t ring_capacity)
+    : m_reader(std::move(reader))
+    , m_decode_frame(m_reader.width(), m_reader.height())
+    , m_ring(ring_capacity, m_reader.width(), m_reader.height())
+    , m_running(false)
+    , m_failed(false)
+    , m_decoded(0)
+    , m_presented(0)
+    , m_dropped(0)
+    , m_underruns(0)
+    , m_expected_ms(0) { }
+
+//-----------------------------------------------------------------------------
+video_player::~video_player() {
+    stop();
+}
+
+//-----------------------------------------------------------------------------
+void video_player::start() {
+    if ( m_running ) {
+        return;
+    }
+    m_start_time = clock::now();
+    m_running = true;
+    m_decode_thread = std::thread([this]() { decode(); });
+}
+
+//-----------------------------------------------------------------------------
+void video_player::stop() {
+    m_running = false;
+    m_ring.close();
+    if ( m_decode_thread.joinable() ) {
+        m_decode_thread.join();
+    }
+}
+
+//-----------------------------------------------------------------------------
+void video_player::decode() {
+    if ( m_thread_start_handler ) {
+        m_thread_start_handler();
+    }
+    while ( m_running ) {
+        auto slot = m_ring.acquire();
+        if ( slot == nullptr ) {
+            break;
+        }
+
+        auto timestamp = m_reader.read_frame(m_decode_frame);
+        if ( !timestamp ) {
+            m_error = timestamp.get_error();
+            m_failed = true;
+            break;
+        }
+
+        kernels::copy(slot->frame, m_decode_frame);
+        slot->timestamp_ms = timestamp.get_value();
+        m_ring.commit();
+        m_decoded.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+//-----------------------------------------------------------------------------
+bool video_player::update(framebuffer& target, clock::time_point now) {
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - m_start_time).count();
+    auto is_due = [elapsed](const timed_frame* frame) {
+        return (frame != nullptr) && (static_cast<int64_t>(frame->timestamp_ms) <= elapsed);
+    };
+
+    auto frame = m_ring.peek();
+    if ( !is_due(frame) ) {
+        // an empty ring is only an underrun once a frame should have been shown, and counts once per frame interval
+        if ( (frame == nullptr) && (elapsed >= static_cast<int64_t>(m_expected_ms)) ) {
+            m_underruns++;
+            m_expected_ms = elapsed + m_reader.frame_interval_ms();
+        }
+        return false;
+    }
+
+    // skip to the newest frame that is already due
+    while ( is_due(m_ring.peek(1)) ) {
+        m_ring.pop();
+        m_dropped++;
+    }
+
+    kernels::copy(target, m_ring.peek()->frame);
+    m_expected_ms = m_ring.peek()->timestamp_ms + m_reader.frame_interval_ms();
+    m_ring.pop();
+    m_presented++;
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+std::optional<video_player::clock::time_point> video_player::next_deadline() {
+    auto frame = m_ring.peek();
+    if ( frame == nullptr ) {
+        return {};
+    }
+    return m_start_time + std::chrono::milliseconds(frame->timestamp_ms);
+}
+
+//-----------------------------------------------------------------------------
+std::string video_player::error() const {
+    return m_failed ? m_error : std::string{};
+}
+
+//-----------------------------------------------------------------------------
+video_statistics video_player::statistics() const {
+    return video_statistics{m_decoded.load(std::memory_order_relaxed), m_presented, m_dropped, m_underruns};
+}
+
+};  // namespace graphics
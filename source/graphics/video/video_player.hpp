@@ -0,0 +1,107 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "frame_ring.hpp"
+#include "framebuffer.hpp"
+#include "video_reader.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <thread>
+
+namespace graphics
+{
+
+// Playback counters
+struct video_statistics {
+    uint64_t decoded;     // frames decoded by the background thread
+    uint64_t presented;   // frames copied out for presentation
+    uint64_t dropped;     // frames skipped because a later frame was already due
+    uint64_t underruns;   // frame intervals that passed with the next frame due but not yet decoded
+};
+
+// Plays a video file by decoding ahead on a background thread into a bounded ring of frames. The render
+// loop asks for the frame due at the current time; decoding stalls are absorbed by the frames already in the ring,
+// and if presentation falls behind, late frames are dropped to keep to the clip's timeline.
+class video_player {
+  public:
+    using clock = std::chrono::steady_clock;
+
+    /**
+     * \brief Construct a new video player
+     *
+     * \param reader the opened video
+     * \param ring_capacity number of frames to decode ahead
+     */
+    explicit video_player(video_reader&& reader, std::size_t ring_capacity = 8);
+
+    ~video_player();
+
+    /**
+     * \brief set a function the decode thread runs first, for example to set its cores and scheduling policy. Set it
+     *        before starting the player.
+     *
+     * \param handler the function, called on the decode thread
+     */
+    void set_thread_start_handler(std::function<void()> handler) {
+        m_thread_start_handler = std::move(handler);
+    }
+
+    /**
+     * \brief start decoding and anchor the clip timeline to the current time
+     */
+    void start();
+
+    /**
+     * \brief stop the decode thread
+     */
+    void stop();
+
+    /**
+     * \brief copy the frame due at a point in time into the target frame
+     *
+     * \param target frame to copy into
+     * \param now the current time
+     * \retval true if the target was updated
+     */
+    bool update(framebuffer& target, clock::time_point now);
+
+    /**
+     * \brief time the next frame is due, if it has been decoded
+     *
+     * \retval std::optional<clock::time_point>
+     */
+    std::optional<clock::time_point> next_deadline();
+
+    // Get the last decode error, empty if there was none
+    std::string error() const;
+
+    // Get the playback counters
+    video_statistics statistics() const;
+
+  private:
+    // Decode thread body
+    void decode();
+
+    video_reader m_reader;
+    framebuffer m_decode_frame;
+    frame_ring m_ring;
+    clock::time_point m_start_time;
+    std::thread m_decode_thread;
+    std::function<void()> m_thread_start_handler;
+    std::atomic<bool> m_running;
+    std::atomic<bool> m_failed;
+    std::string m_error;
+    std::atomic<uint64_t> m_decoded;
+    uint64_t m_presented;
+    uint64_t m_dropped;
+    uint64_t m_underruns;
+    uint64_t m_expected_ms;  // time on the clip timeline the next frame is expected by
+};
+
+};  // namespace graphics
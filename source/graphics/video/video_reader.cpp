@@ -0,0 +1,113 @@
+// RGB LED Matrix Graphics Library
+
+#include "video_reader.hpp"
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <utility>
+
+namespace graphics
+{
+//-----------------------------------------------------------------------------
+expected<video_reader, std::string> video_reader::open(const std::string& path, int width, int height) {
+    std::ifstream stream{path, std::ios::binary};
+    video_header header;
+    if ( !stream.read(reinterpret_cast<char*>(&header), sizeof(header)) ) {
+        return expected<video_reader, std::string>::error("Could not read video header from " + path);
+    }
+
+    if ( (header.magic != video_magic) || (header.version != video_version) || (header.frame_count == 0) || (header.width == 0) ||
+         (header.height == 0) || (header.width > video_max_side) || (header.height > video_max_side) || (header.duration_ms == 0) ) {
+        return expected<video_reader, std::string>::error("Invalid video header");
+    }
+
+    // frames are copied into the target as a flat block, so a clip of any other size would be sheared across rows
+    if ( (header.width != width) || (header.height != height) ) {
+        return expected<video_reader, std::string>::error("Video is " + std::to_string(header.width) + "x" + std::to_string(header.height) +
+                                                          ", expected " + std::to_string(width) + "x" + std::to_string(height));
+    }
+
+    return expected<video_reader, std::string>::success(video_reader{std::move(stream), header});
+}
+
+//-----------------------------------------------------------------------------
+video_reader::video_reader(std::ifstream&& stream, const video_header& header)
+    : m_stream(std::move(stream))
+    , m_header(header)
+    , m_frame_index(0)
+    , m_loop_offset_ms(0) { }
+
+//-----------------------------------------------------------------------------
+void video_reader::rewind() {
+    m_stream.clear();
+    m_stream.seekg(sizeof(video_header));
+    m_frame_index = 0;
+    m_loop_offset_ms += m_header.duration_ms;
+}
+
+//-----------------------------------------------------------------------------
+expected<uint64_t, std::string> video_reader::read_frame(framebuffer& frame) {
+    if ( m_frame_index == m_header.frame_count ) {
+        rewind();
+    }
+
+    video_frame_header frame_header;
+    if ( !m_stream.read(reinterpret_cast<char*>(&frame_header), sizeof(frame_header)) || (frame_header.payload_size % 4 != 0) ) {
+        return expected<uint64_t, std::string>::error("Truncated video frame");
+    }
+
+    // a corrupt size must not grow the buffer past one raw frame, which every encoding fits in
+    if ( frame_header.payload_size > static_cast<std::size_t>(m_header.width) * m_header.height * sizeof(packed_pixel) ) {
+        return expected<uint64_t, std::string>::error("Video frame larger than a raw frame");
+    }
+    m_payload.resize(frame_header.payload_size / 4);
+    if ( !m_stream.read(reinterpret_cast<char*>(m_payload.data()), frame_header.payload_size) ) {
+        return expected<uint64_t, std::string>::error("Truncated video frame");
+    }
+    m_frame_index++;
+
+    auto pixels = frame.data();
+    auto pixel_count = std::min(frame.size(), static_cast<std::size_t>(m_header.width) * m_header.height);
+    auto payload = m_payload.data();
+    auto payload_end = payload + m_payload.size();
+
+    switch ( static_cast<frame_encoding>(frame_header.encoding) ) {
+        case frame_encoding::raw:
+            std::memcpy(pixels, payload, std::min(pixel_count, m_payload.size()) * sizeof(packed_pixel));
+            break;
+
+        case frame_encoding::rle: {
+            std::size_t position = 0;
+            while ( (payload + 2 <= payload_end) && (position < pixel_count) ) {
+                auto count = std::min<std::size_t>(payload[0], pixel_count - position);
+                std::fill(pixels + position, pixels + position + count, payload[1]);
+                position += count;
+                payload += 2;
+            }
+            break;
+        }
+
+        case frame_encoding::delta: {
+            std::size_t position = 0;
+            while ( payload + 2 <= payload_end ) {
+                position += payload[0];
+                std::size_t count = payload[1];
+                payload += 2;
+                if ( (position + count > pixel_count) || (payload + count > payload_end) ) {
+                    return expected<uint64_t, std::string>::error("Corrupt delta frame");
+                }
+                std::memcpy(pixels + position, payload, count * sizeof(packed_pixel));
+                position += count;
+                payload += count;
+            }
+            break;
+        }
+
+        default:
+            return expected<uint64_t, std::string>::error("Unknown frame encoding");
+    }
+
+    return expected<uint64_t, std::string>::success(m_loop_offset_ms + frame_header.timestamp_ms);
+}
+
+};  // namespace graphics
@@ -0,0 +1,104 @@
+// RGB LED Matrix Graphics Library
+
+#pragma once
+
+#include "expected.hpp"
+#include "framebuffer.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace graphics
+{
+
+// On-disk video layout. All values are little endian. Frames are sized to the panel and are read sequentially,
+// so clips of any length stream with a fixed amount of memory.
+//
+//  video_header
+//  { video_frame_header, payload }[frame_count]
+//
+// Payload encodings, each no larger than a raw frame (video_packer.py stores whichever is smallest):
+//  raw:   width * height packed pixels (0x00RRGGBB)
+//  rle:   { uint32 count, uint32 pixel } runs covering the whole frame
+//  delta: { uint32 skip, uint32 count, uint32 pixel[count] } runs applied on top of the previous frame
+constexpr uint32_t video_magic = 0x5650524C;  // file starts with the bytes "LRPV"
+constexpr uint16_t video_version = 1;
+constexpr uint16_t video_max_side = 4096;     // largest width or height accepted, bounding the payload buffer
+
+enum class frame_encoding : uint8_t { raw = 0, rle = 1, delta = 2 };
+
+struct video_header {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t flags;
+    uint16_t width;
+    uint16_t height;
+    uint32_t frame_count;
+    uint32_t duration_ms;     // length of the clip, used to offset timestamps when looping. Must not be 0.
+    uint32_t reserved;
+};
+
+struct video_frame_header {
+    uint32_t timestamp_ms;    // presentation time relative to the start of the clip
+    uint8_t encoding;
+    uint8_t reserved[3];
+    uint32_t payload_size;    // bytes of payload following the header
+};
+
+static_assert(sizeof(video_header) == 24, "video header must match the file format");
+static_assert(sizeof(video_frame_header) == 12, "video frame header must match the file format");
+
+// Sequential decoder for a video file. Loops back to the first frame at the end of the clip.
+class video_reader {
+  public:
+    /**
+     * \brief Factory method to open a video file
+     *
+     * \param path path to the video file
+     * \param width width of the frames the clip is shown on. Clips of any other size are rejected.
+     * \param height height of the frames the clip is shown on
+     * \retval expected<video_reader, std::string>
+     */
+    static expected<video_reader, std::string> open(const std::string& path, int width, int height);
+
+    video_reader(video_reader&& other) = default;
+
+    /**
+     * \brief decode the next frame. The frame is kept between calls as delta frames are applied on top of it.
+     *
+     * \param frame frame of the video size to decode into
+     * \retval expected<uint64_t, std::string> presentation time of the frame in milliseconds, increasing across loops
+     */
+    expected<uint64_t, std::string> read_frame(framebuffer& frame);
+
+    // Width of the video frames
+    int width() const {
+        return m_header.width;
+    }
+
+    // Height of the video frames
+    int height() const {
+        return m_header.height;
+    }
+
+    // Average time between frames, at least 1ms
+    uint32_t frame_interval_ms() const {
+        return std::max<uint32_t>(m_header.duration_ms / m_header.frame_count, 1);
+    }
+
+  private:
+    video_reader(std::ifstream&& stream, const video_header& header);
+
+    // Seek back to the first frame
+    void rewind();
+
+    std::ifstream m_stream;
+    video_header m_header;
+    uint32_t m_frame_index;
+    uint64_t m_loop_offset_ms;
+    std::vector<uint32_t> m_payload;
+};
+
+};  // namespace graphics
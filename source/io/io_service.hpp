@@ -20,6 +20,12 @@
 #include <utility>
 
 /********************************** Types *******************************************/
+/**
+ * \brief function that answers a received message. Returns the reply to write back to the client, or an empty
+ *        string to send nothing.
+ */
+using reply_function = std::function<std::string(const std::string&)>;
+
 /**
  * \brief asynchronous session handling class that will continue to receive messages on a session object
  *        until otherwise notified.
@@ -36,10 +42,12 @@ class io_session : public std::enable_shared_from_this<io_session<EmitFunction>>
      * 
      * \param socket rvalue reference to a socket object
      * \param emitter emit function which passes received messages to a handler function
+     * \param responder optional function whose replies to received messages are written back to the client
      */
-    io_session(tcp::socket&& socket, EmitFunction emitter)
+    io_session(tcp::socket&& socket, EmitFunction emitter, reply_function responder = nullptr)
         : _socket(std::move(socket))
-        , _emitter(emitter) { }
+        , _emitter(emitter)
+        , _responder(std::move(responder)) { }
 
     /**
      * \brief start the session service
@@ -55,18 +63,46 @@ class io_session : public std::enable_shared_from_this<io_session<EmitFunction>>
     /**
      * \brief asynchronously read from a session until a new line is received. The new line is then passed
      *        to any message handlers registered to the session and the session is preserved by re-starting the 
-     *        read function, which creates a new shared_ptr reference count to the current object.
+     *        read function, which creates a new shared_ptr reference count to the current object. A reply to
+     *        the line is written before the next read starts, so replies go out in request order.
      * 
      */
     void async_read() {
         auto self = shared_session::shared_from_this();  // creates a new std::shared_ptr reference to the current object
         boost::asio::async_read_until(_socket, _data, '\n', [this, self](auto& error, auto size) {
+            // a closed or failed socket completes every read straight away, so end the session rather than re-arm
+            if ( error ) {
+                if ( error != boost::asio::error::eof ) {
+                    std::cerr << error.message() << std::endl;
+                }
+                return;
+            }
+
             std::istream in_stream(&_data);
             std::string line;
             std::getline(in_stream, line);
+            _reply = _responder ? _responder(line) : std::string{};
             _emitter(std::move(line));
 
-            async_read();  // re-start the read to keep the session alive
+            if ( _reply.empty() ) {
+                async_read();  // re-start the read to keep the session alive
+            } else {
+                async_write();
+            }
+        });
+    }
+
+    /**
+     * \brief asynchronously write the reply to the last message, then go back to reading
+     */
+    void async_write() {
+        auto self = shared_session::shared_from_this();
+        boost::asio::async_write(_socket, boost::asio::buffer(_reply), [this, self](auto& error, auto) {
+            if ( error ) {
+                std::cerr << error.message() << std::endl;
+                return;
+            }
+            async_read();
         });
     }
 
@@ -74,6 +110,8 @@ class io_session : public std::enable_shared_from_this<io_session<EmitFunction>>
     boost::asio::streambuf _data;
     tcp::socket _socket;
     EmitFunction _emitter;
+    reply_function _responder;
+    std::string _reply;
 };
 
 /**
@@ -82,11 +120,12 @@ class io_session : public std::enable_shared_from_this<io_session<EmitFunction>>
  * 
  * \param socket universal reference to the socket object
  * \param emitter universal reference to the emitter function
+ * \param responder optional function that answers received messages
  * \retval auto shared_ptr to the session
  */
 template <typename Socket, typename EmitFunction>
-auto make_shared_session(Socket&& socket, EmitFunction&& emitter) {
-    return std::make_shared<io_session<EmitFunction>>(std::forward<Socket>(socket), std::forward<EmitFunction>(emitter));
+auto make_shared_session(Socket&& socket, EmitFunction&& emitter, reply_function responder = nullptr) {
+    return std::make_shared<io_session<EmitFunction>>(std::forward<Socket>(socket), std::forward<EmitFunction>(emitter), std::move(responder));
 }
 
 /**
@@ -127,6 +166,16 @@ class io_service {
         accept_connections();
     }
 
+    /**
+     * \brief Set the reply handler function, which answers received messages before they are emitted. Set it
+     *        before the emit handler so no session is accepted without it.
+     * 
+     * \param responder function returning the reply to a message, or an empty string for no reply
+     */
+    void set_reply_handler(reply_function responder) {
+        _responder = std::move(responder);
+    }
+
   private:
     /**
      * \brief accept connections over TCP and create a new session object for each client
@@ -136,7 +185,7 @@ class io_service {
         _acceptor.async_accept(_socket, [this](const boost::system::error_code& error) {
             if ( !error ) {
                 // move the ownership of the socket into the session and start the session
-                auto session = make_shared_session(std::move(_socket), _emitter);
+                auto session = make_shared_session(std::move(_socket), _emitter, _responder);
                 session->start();
             } else {
                 std::cerr << error.message() << std::endl;
@@ -150,4 +199,5 @@ class io_service {
     tcp::acceptor _acceptor;
     tcp::socket _socket;
     std::function<void(std::string&&)> _emitter;
+    reply_function _responder;
 };
\ No newline at end of file
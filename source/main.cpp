@@ -1,19 +1,367 @@
 #include "graphics.hpp"
-#include "simple_clock_task.hpp"
+#include "alert_task.hpp"
+#include "content_arbiter.hpp"
+#include "frame_scheduler.hpp"
+#include "interval_display.hpp"
+#include "interval_timer.hpp"
+#include "io_service.hpp"
+#include "simple_clock.hpp"
+#include "thread_tuning.hpp"
+#include "tile_renderer.hpp"
+#include "video_task.hpp"
+#include <algorithm>
+#include <condition_variable>
+#include <csignal>
+#include <cstdint>
 #include <fstream>
+#include <future>
+#include <iostream>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <thread>
 
 
+// Print how late the phase transitions of a finished workout were handled
+static void report_lateness(const intervals::lateness_histogram& lateness) {
+    fmt::print("workout finished: {} transitions, latest {}us\n", lateness.count(), lateness.max().count());
+    for ( std::size_t i = 0; i < intervals::lateness_histogram::bucket_count; i++ ) {
+        if ( i + 1 < intervals::lateness_histogram::bucket_count ) {
+            fmt::print("  < {:>6}us: {}\n", intervals::lateness_histogram::limit_us(i), lateness.bucket(i));
+        } else {
+            fmt::print("  >={:>6}us: {}\n", intervals::lateness_histogram::limit_us(i - 1), lateness.bucket(i));
+        }
+    }
+}
+
+// Print how often each quality level was used and where frame time went
+static void report_budget(const graphics::frame_budget& budget) {
+    auto stats = budget.statistics();
+    fmt::print("frames: {} checked, {} over budget, {} steps down, {} steps up\n", stats.frames, stats.overruns, stats.step_downs, stats.step_ups);
+    constexpr std::array<const char*, graphics::frame_phase_count> phase_names = {"update", "render", "post-process", "present"};
+    for ( std::size_t i = 0; i < graphics::frame_phase_count; i++ ) {
+        fmt::print("  {:<12} average {}us peak {}us\n", phase_names[i], stats.phases[i].average_us, stats.phases[i].peak_us);
+    }
+    for ( std::size_t knob = 0; knob < budget.knob_count(); knob++ ) {
+        const auto& usage = budget.knob_usage(knob);
+        for ( std::size_t level = 0; level < usage.size(); level++ ) {
+            fmt::print("  {} level {}: {} frames\n", budget.knob_name(knob), level, usage[level]);
+        }
+    }
+}
+
+// Print the settings a thread runs with and any that could not be applied
+static void report_thread(const char* role, const tasks::thread_handle& handle, const std::string& errors) {
+    fmt::print("{} thread: {}{}\n", role, tasks::describe_thread(handle), errors.empty() ? "" : fmt::format(" ({} failed)", errors));
+}
+
+// Print how far buffer swaps landed from the panel refresh under the current thread settings
+static void report_jitter(const tasks::refresh_jitter& jitter) {
+    auto stats = jitter.stats();
+    fmt::print("refresh jitter: {} swaps against a {}us period, mean {}us max {}us, {} late\n",
+               stats.samples,
+               jitter.refresh_period().count(),
+               stats.mean.count(),
+               stats.max.count(),
+               stats.late);
+}
+
 // Main program entry point
 int main(int argc, char* argv[]) {
     auto matrix = graphics::matrix::from_config("/home/pi/led-matrix/config.json");
     auto time_font = graphics::fonts::font::load_from_path("/home/pi/led-matrix/graphics/fonts/9x18B.bdf").get_value();
     
+    auto& options = matrix.options();
+
+    // post-processing applied to every frame that changes before it is swapped on to the panel
+    graphics::frame_pipeline pipeline{graphics::pixel_remap{matrix.width(), matrix.height(), options.app_options.transform}};
+    pipeline.add_stage(std::make_shared<graphics::color_correction>(options.app_options.color));
+    pipeline.add_stage(std::make_shared<graphics::power_limiter>(options.app_options.power));
+    auto dither = std::make_shared<graphics::dithering>(pipeline.width(), options.options.pwm_bits, options.app_options.dither);
+    pipeline.add_stage(dither);
+    tasks::refresh_jitter jitter{options.options.limit_refresh_rate_hz};
+    graphics::frame_presenter presenter{pipeline, [&](const graphics::framebuffer& frame) { matrix.upload(frame); }, [&]() {
+        matrix.swap();
+        jitter.record(std::chrono::steady_clock::now());
+    }};
+
+    // every presented frame is kept for snapshot requests over TCP. Snapshots show the logical canvas as rendered,
+    // before color correction, power limiting and dithering, which would otherwise darken and speckle the image.
+    graphics::frame_snapshot snapshot{pipeline.width(), pipeline.height()};
+    presenter.set_snapshot(&snapshot);
+
+    // every phase of a frame is timed against the budget. Its quality knobs are added once the render loop exists.
+    graphics::frame_budget budget{options.app_options.budget};
+    presenter.set_budget(&budget);
+    auto refresh_period = std::chrono::milliseconds(16);
+
+    // layouts are drawn in row bands across a pool with one worker per core of the tasks role, and the render thread
+    // helps with each batch. Every worker is held to its own core with the rest of the tasks policy, applied before
+    // the matrix drops root.
+    const auto& worker_cores = options.app_options.threads.tasks.cores;
+    std::vector<tasks::thread_handle> worker_handles(worker_cores.size());
+    std::mutex worker_mutex;
+    std::condition_variable worker_started;
+    std::size_t workers_started = 0;
+    auto worker_policy = [&](const graphics::thread_policy& policy, std::size_t worker) {
+        auto pinned = policy;
+        pinned.cores = (worker_cores[worker] >= 0) ? std::vector<int>{worker_cores[worker]} : std::vector<int>{};
+        return pinned;
+    };
+    tasks::work_stealing_pool pool{worker_cores, [&](std::size_t worker) {
+                                       std::lock_guard<std::mutex> lock{worker_mutex};
+                                       worker_handles[worker] = tasks::current_thread();
+                                       auto errors = tasks::apply_thread_policy(worker_handles[worker], worker_policy(options.app_options.threads.tasks, worker));
+                                       report_thread(fmt::format("render worker {}", worker).c_str(), worker_handles[worker], errors);
+                                       workers_started++;
+                                       worker_started.notify_one();
+                                   }};
+    {
+        std::unique_lock<std::mutex> lock{worker_mutex};
+        worker_started.wait(lock, [&]() { return workers_started == worker_cores.size(); });
+    }
+    tasks::tile_renderer tiles{pool};
+
+    // the network thread starts serving once the server is set up below, but takes its policy while there is still root
+    boost::asio::io_service io_context;
+    boost::asio::io_service::work io_work{io_context};
+    tasks::thread_handle io_handle{};
+    std::promise<void> io_ready;
+    std::thread io_thread{[&]() {
+        io_handle = tasks::current_thread();
+        report_thread("io", io_handle, tasks::apply_thread_policy(io_handle, options.app_options.threads.io));
+        io_ready.set_value();
+        io_context.run();
+    }};
+    io_ready.get_future().wait();
+
+    // the frame loop runs on this thread. Its policy is applied before the matrix starts refreshing and drops root.
+    auto render_thread = tasks::current_thread();
+    report_thread("render", render_thread, tasks::apply_thread_policy(render_thread, options.app_options.threads.render));
     matrix.start();    
-    auto canvas = matrix.create_canvas();
-    auto task = std::make_unique<simple_clock_task>(time_font, canvas);
-    task->start();
-    task->await_complete();
+    graphics::framebuffer frame{pipeline.width(), pipeline.height()};
+    graphics::region_display display{frame.width(), frame.height()};
+    auto clock_region = display.add_region("clock", graphics::rect{0, 0, static_cast<uint16_t>(frame.width()), static_cast<uint16_t>(frame.height())});
+
+    // alerts pushed over TCP preempt everything else on the display, most urgent first
+    tasks::content_arbiter arbiter;
+
+    // one render loop: widgets ask to be redrawn when their content changes and each batch of redraws presents one frame.
+    // A change to a post-processing stage also presents, as it changes what an unchanged frame looks like on the panel.
+    uint64_t presented_revision = pipeline.revision();
+    tasks::frame_scheduler scheduler{[&]() {
+        std::size_t composed = 0;
+        {
+            auto render = budget.measure(graphics::frame_phase::render);
+            composed = display.compose(frame);
+        }
+        if ( (composed > 0) || pipeline.is_temporal() || (pipeline.revision() != presented_revision) ) {
+            presented_revision = pipeline.revision();
+            presenter.present(frame);
+            arbiter.presented(std::chrono::steady_clock::now());
+        }
+        budget.end_frame();
+    }};
+
+    // temporal dithering needs a fresh frame every refresh even when nothing has changed
+    if ( pipeline.is_temporal() ) {
+        scheduler.add([&](auto now) { return std::optional{now + refresh_period}; });
+    }
+
+    // a running workout takes over the display. Otherwise a layout pushed over TCP is drawn in place of the clock
+    // until an empty layout is pushed.
+    intervals::interval_timer timer;
+    intervals::interval_display timer_display{graphics::origin{0, 0}, time_font};
+    graphics::layout_switcher layouts;
+    graphics::font_table fonts{{"9x18B", &time_font}};
+    graphics::clocks::simple_clock clock{graphics::origin{0, 0}, time_font};
+    auto display_redraw = scheduler.add([&](auto now) {
+        {
+            auto update = budget.measure(graphics::frame_phase::update);
+            if ( timer.update(now) && !timer.is_running() ) {
+                report_lateness(timer.lateness());
+            }
+        }
+        auto render = budget.measure(graphics::frame_phase::render);
+        clock_region.get_value()->draw([&](graphics::canvas& canvas) {
+            if ( arbiter.draw(canvas, now) ) {
+                return;
+            }
+            if ( timer.is_running() ) {
+                timer_display.draw(canvas, timer, now);
+            } else if ( auto layout = layouts.current() ) {
+                tiles.render(canvas, [&](graphics::canvas& tile) { layout->execute(tile); });
+            } else {
+                clock.draw(canvas);
+            }
+        });
+        auto next = timer.is_running() ? timer.next_deadline(now).value() : clock.next_update();
+        return std::optional{std::min(next, arbiter.next_deadline().value_or(next))};
+    });
+    arbiter.set_wake_handler([&]() { scheduler.reschedule(display_redraw, std::chrono::steady_clock::now()); });
+
+    // sustained overruns first slow the temporal dithering refresh, then step the dithering mode down towards plain
+    // quantization, and both come back once there is headroom again. A new dithering mode wakes the loop so a static
+    // display shows it straight away rather than at its next redraw.
+    if ( pipeline.is_temporal() ) {
+        budget.add_knob(graphics::quality_knob{"refresh_rate", 3, [&](unsigned level) { refresh_period = std::chrono::milliseconds(16 + 17 * level); }});
+    }
+    budget.add_knob(graphics::quality_knob{"dither_mode", static_cast<unsigned>(options.app_options.dither) + 1, [&](unsigned level) {
+                                               dither->set_mode(static_cast<graphics::dither_mode>(static_cast<unsigned>(options.app_options.dither) - level));
+                                               scheduler.reschedule(display_redraw, std::chrono::steady_clock::now());
+                                           }});
+
+    // layouts are compiled on the network thread so switching never touches the render loop's time budget
+    std::optional<tasks::content_arbiter::task_id> video_id;
+    io_service server{io_context};
+
+    // a snapshot request is answered with the byte count of the image on its own line, then the image itself. The
+    // count is 0 until the first frame has been presented.
+    graphics::framebuffer snapshot_frame{pipeline.width(), pipeline.height()};
+    server.set_reply_handler([&](const std::string& message) {
+        auto request = json::parse(message, nullptr, false);
+        if ( request.is_discarded() || !request.is_object() || !request.contains("snapshot") ) {
+            return std::string{};
+        }
+        auto format = request["snapshot"].is_string() ? request["snapshot"].get<std::string>() : std::string{};
+        if ( (format != "ppm") && (format != "rle") ) {
+            std::cerr << "snapshot format must be ppm or rle" << std::endl;
+            return std::string{};
+        }
+        if ( snapshot.read(snapshot_frame) == 0 ) {
+            return std::string{"0\n"};
+        }
+        auto image = graphics::encode_snapshot(snapshot_frame, (format == "ppm") ? graphics::snapshot_format::ppm : graphics::snapshot_format::rle);
+        return std::to_string(image.size()) + "\n" + std::string(image.begin(), image.end());
+    });
+    server.set_message_emit_handler([&](std::string&& message) {
+        auto received = std::chrono::steady_clock::now();
+        auto request = json::parse(message, nullptr, false);
+        if ( request.is_discarded() || !request.is_object() ) {
+            return;
+        }
+
+        // the workout starts on the render loop so the schedule and the display share one clock reading
+        if ( request.contains("high_interval_ms") ) {
+            auto settings = intervals::interval_settings::from_json(request);
+            if ( !settings ) {
+                std::cerr << settings.get_error() << std::endl;
+                return;
+            }
+            scheduler.add([&, workout = settings.get_value()](auto now) {
+                timer.start(workout, now);
+                scheduler.reschedule(display_redraw, now);
+                return std::optional<tasks::frame_scheduler::time_point>{};
+            });
+            return;
+        }
+
+        // alerts are measured from the moment the message arrived to the moment they reach the panel
+        if ( request.contains("alert") && request["alert"].is_string() ) {
+            auto duration_ms = request.contains("duration_ms") ? request["duration_ms"] : json(5000);
+            auto priority = request.contains("priority") ? request["priority"] : json(10);
+            if ( !duration_ms.is_number_integer() || !priority.is_number_integer() ) {
+                std::cerr << "alert duration_ms and priority must be integers" << std::endl;
+                return;
+            }
+            auto duration = std::chrono::milliseconds(std::clamp<int64_t>(duration_ms.get<int64_t>(), 1, 3600000));
+            auto alert = std::make_shared<tasks::alert_task>(request["alert"].get<std::string>(), time_font, graphics::pixel{255, 0, 0}, duration);
+            arbiter.submit(alert, static_cast<int>(std::clamp<int64_t>(priority.get<int64_t>(), INT32_MIN, INT32_MAX)), received);
+            return;
+        }
+
+        // a clip replaces the one playing, if any, and plays below alerts until it is stopped with a null path
+        if ( request.contains("video") ) {
+            if ( video_id ) {
+                arbiter.remove(*video_id);
+                video_id.reset();
+                scheduler.reschedule(display_redraw, std::chrono::steady_clock::now());
+            }
+            if ( request["video"].is_null() ) {
+                return;
+            }
+            if ( !request["video"].is_string() ) {
+                std::cerr << "video must be a path or null" << std::endl;
+                return;
+            }
+            auto reader = graphics::video_reader::open(request["video"].get<std::string>(), frame.width(), frame.height());
+            if ( !reader ) {
+                std::cerr << reader.get_error() << std::endl;
+                return;
+            }
+            auto clip = std::make_shared<tasks::video_task>(std::move(reader.get_value()), [&]() {
+                auto decode_thread = tasks::current_thread();
+                report_thread("video decode", decode_thread, tasks::apply_thread_policy(decode_thread, options.app_options.threads.tasks));
+            });
+            video_id = arbiter.submit(clip, 0, received);
+            return;
+        }
+
+        // thread settings can be changed while running to compare the refresh jitter each one causes
+        if ( request.contains("threads") && request["threads"].is_object() ) {
+            auto threads = graphics::parse_thread_settings(request["threads"]);
+            if ( (geteuid() != 0) && (tasks::needs_privileges(threads.io) || tasks::needs_privileges(threads.render) ||
+                                      tasks::needs_privileges(threads.tasks)) ) {
+                std::cerr << "thread settings with the fifo policy or a negative nice value need root, set drop_privileges to false to try them" << std::endl;
+                return;
+            }
+            report_thread("io", io_handle, tasks::apply_thread_policy(io_handle, threads.io));
+            report_thread("render", render_thread, tasks::apply_thread_policy(render_thread, threads.render));
+            {
+                std::lock_guard<std::mutex> lock{worker_mutex};
+                for ( std::size_t worker = 0; worker < worker_handles.size(); worker++ ) {
+                    auto errors = tasks::apply_thread_policy(worker_handles[worker], worker_policy(threads.tasks, worker));
+                    report_thread(fmt::format("render worker {}", worker).c_str(), worker_handles[worker], errors);
+                }
+            }
+            scheduler.add([&](auto) {
+                report_jitter(jitter);
+                jitter.reset();
+                return std::optional<tasks::frame_scheduler::time_point>{};
+            });
+            return;
+        }
+
+        if ( !request.contains("layout") ) {
+            return;
+        }
+        if ( request["layout"].is_null() ) {
+            layouts.set(nullptr);
+        } else {
+            auto layout = graphics::display_list::from_json(request["layout"], fonts);
+            if ( !layout ) {
+                std::cerr << layout.get_error() << std::endl;
+                return;
+            }
+            layouts.set(std::make_shared<const graphics::display_list>(std::move(layout.get_value())));
+        }
+        scheduler.reschedule(display_redraw, std::chrono::steady_clock::now());
+    });
+    // ctrl-c or a service stop ends the render loop so the counters below are reported. The signals are handled on the
+    // IO thread through asio, never inside a signal handler, because stopping the scheduler takes its mutex.
+    boost::asio::signal_set signals{io_context, SIGINT, SIGTERM};
+    signals.async_wait([&](const boost::system::error_code& error, int) {
+        if ( !error ) {
+            scheduler.stop();
+        }
+    });
+    scheduler.run();
+    io_context.stop();
+    io_thread.join();
+
+    report_budget(budget);
+    report_jitter(jitter);
+    auto workers = pool.stats();
+    fmt::print("render pool: {} workers ({} pinned), {} jobs, {} steals\n", pool.workers(), workers.pinned, workers.jobs, workers.steals);
+    auto alerts = arbiter.stats();
+    if ( alerts.latency_count > 0 ) {
+        fmt::print("alerts: {} shown, {} preemptions, latency mean {}us max {}us, {} over budget\n",
+                   alerts.latency_count,
+                   alerts.preemptions,
+                   alerts.total_latency.count() / static_cast<int64_t>(alerts.latency_count),
+                   alerts.max_latency.count(),
+                   alerts.over_budget);
+    }
     return 0;
 }
@@ -0,0 +1,109 @@
+/**
+ * \file animation_tests.cpp
+ * \brief unit tests for the fixed point easing tables and the keyframe animator
+ * \version 0.1
+ * \date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+
+/********************************** Includes *******************************************/
+#include "gtest/gtest.h"
+#include "animator.hpp"
+#include "easing.hpp"
+#include "rectangle.hpp"
+#include <chrono>
+#include <memory>
+
+using namespace std::chrono_literals;
+using namespace graphics;
+
+
+/****************************** Unit Tests ***********************************/
+/* test that every curve starts at zero and ends at one, and the tables are built at compile time */
+TEST(animation_tests, test_easing_end_points) {
+    static_assert(ease(easing::linear, easing_one / 2) == easing_one / 2);
+    static_assert(ease(easing::quad_in, easing_one / 2) == easing_one / 4);
+    for ( int curve = 0; curve <= static_cast<int>(easing::bounce_out); curve++ ) {
+        EXPECT_EQ(ease(static_cast<easing>(curve), 0), 0);
+        EXPECT_EQ(ease(static_cast<easing>(curve), easing_one), easing_one);
+    }
+}
+
+/* test curve shapes between table entries */
+TEST(animation_tests, test_easing_curves) {
+    EXPECT_NEAR(ease(easing::quad_out, easing_one / 2), 3 * easing_one / 4, 2);
+    EXPECT_NEAR(ease(easing::sine_in_out, easing_one / 2), easing_one / 2, 2);
+    EXPECT_GT(ease(easing::back_out, 3 * easing_one / 4), easing_one);
+
+    // interpolated between entries stays between the neighbouring entries
+    auto low = ease(easing::quad_in, 100 << 8);
+    auto high = ease(easing::quad_in, 101 << 8);
+    auto middle = ease(easing::quad_in, (100 << 8) + 128);
+    EXPECT_GT(middle, low);
+    EXPECT_LT(middle, high);
+}
+
+/* test moving a shape through keyframes with the frame clock */
+TEST(animation_tests, test_origin_track) {
+    auto box = std::make_shared<rectangle>(origin{0, 0}, 2, 2, pixel{255, 255, 255}, true);
+    animator animations;
+    auto start = animator::clock::now();
+    auto id = animations.animate_origin(box, {{0, origin{0, 0}, easing::linear}, {100, origin{40, 10}, easing::linear}, {200, origin{40, 20}, easing::quad_in}}, start);
+
+    EXPECT_EQ(animations.update(start + 50ms), 1u);
+    EXPECT_EQ(box->get_origin().x, 20);
+    EXPECT_EQ(box->get_origin().y, 5);
+
+    animations.update(start + 150ms);
+    EXPECT_EQ(box->get_origin().x, 40);
+    EXPECT_EQ(box->get_origin().y, 12);
+
+    // the track settles on its last keyframe and finishes
+    EXPECT_EQ(animations.update(start + 250ms), 0u);
+    EXPECT_FALSE(animations.is_running(id));
+    EXPECT_EQ(box->get_origin().y, 20);
+}
+
+/* test that unchanged values are not written so the shape revision stays put */
+TEST(animation_tests, test_unchanged_values_are_not_written) {
+    auto box = std::make_shared<rectangle>(origin{0, 0}, 2, 2, pixel{255, 255, 255}, true);
+    animator animations;
+    auto start = animator::clock::now();
+    animations.animate_origin(box, {{0, origin{5, 5}, easing::linear}, {1000, origin{5, 5}, easing::linear}}, start);
+
+    animations.update(start + 10ms);
+    auto revision = box->revision();
+    animations.update(start + 20ms);
+    animations.update(start + 30ms);
+    EXPECT_EQ(box->revision(), revision);
+}
+
+/* test fading and coloring span shapes, and looping and cancelling tracks */
+TEST(animation_tests, test_color_and_opacity_tracks) {
+    auto fade = std::make_shared<rectangle>(origin{0, 0}, 1, 1, pixel{0, 0, 0}, true);
+    auto tint = std::make_shared<rectangle>(origin{0, 0}, 1, 1, pixel{0, 0, 0}, true);
+    animator animations;
+    auto start = animator::clock::now();
+    animations.animate_opacity(fade, pixel{200, 100, 0}, {{0, 0, easing::linear}, {100, 255, easing::linear}}, start);
+    auto looping = animations.animate_color(tint, {{0, pixel{0, 0, 0}, easing::linear}, {100, pixel{100, 0, 200}, easing::linear}}, start, true);
+
+    animations.update(start + 50ms);
+    graphics::framebuffer frame{1, 1};
+    graphics::canvas canvas{&frame};
+    fade->draw(canvas);
+    EXPECT_NEAR(graphics::red_channel(frame.get_pixel(0, 0)), 100, 1);
+    EXPECT_NEAR(graphics::green_channel(frame.get_pixel(0, 0)), 50, 1);
+
+    // the looping track wraps back to its start
+    animations.update(start + 125ms);
+    tint->draw(canvas);
+    EXPECT_EQ(frame.get_pixel(0, 0), graphics::pack(25, 0, 50));
+    EXPECT_TRUE(animations.is_running(looping));
+    EXPECT_EQ(animations.size(), 1u);
+
+    EXPECT_TRUE(animations.cancel(looping));
+    EXPECT_EQ(animations.size(), 0u);
+}
@@ -0,0 +1,114 @@
+/**
+ * \file chart_tests.cpp
+ * \brief unit tests for the rolling sparkline and bar chart shapes
+ * \version 0.1
+ * \date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+
+/********************************** Includes *******************************************/
+#include "gtest/gtest.h"
+#include "bar_chart.hpp"
+#include "canvas.hpp"
+#include "framebuffer.hpp"
+#include "ring_buffer.hpp"
+#include "sparkline.hpp"
+
+/******************************** Local Functions **************************************/
+/* height of the lit column at x, counted up from the bottom */
+static int column_height(const graphics::framebuffer& frame, int x) {
+    int height = 0;
+    for ( int y = 0; y < frame.height(); y++ ) {
+        height += (frame.get_pixel(x, y) != 0) ? 1 : 0;
+    }
+    return height;
+}
+
+
+/****************************** Unit Tests ***********************************/
+/* test that the ring buffer drops its oldest items once full */
+TEST(chart_tests, test_ring_buffer_wraps) {
+    ring_buffer<int> ring{3};
+    for ( int i = 1; i <= 5; i++ ) {
+        ring.push(i);
+    }
+    EXPECT_TRUE(ring.full());
+    EXPECT_EQ(ring[0], 3);
+    EXPECT_EQ(ring[2], 5);
+    EXPECT_EQ(ring.back(), 5);
+}
+
+/* test that new samples within the range only rasterize one column each */
+TEST(chart_tests, test_incremental_update) {
+    graphics::framebuffer frame{4, 4};
+    graphics::canvas canvas{&frame};
+    graphics::bar_chart bars{{0, 0}, 4, 4, 1, 0, graphics::pixel{255, 255, 255}};
+    bars.set_range(0, 3);
+
+    for ( float value : {3.0f, 1.0f} ) {
+        bars.add_sample(value);
+        bars.draw(canvas);
+    }
+    EXPECT_EQ(bars.full_redraws(), 1u);
+    EXPECT_EQ(bars.column_draws(), 1u);
+    EXPECT_EQ(column_height(frame, 2), 4);
+    EXPECT_EQ(column_height(frame, 3), 2);
+
+    // older samples scroll off the left edge
+    for ( float value : {0.0f, 2.0f, 3.0f} ) {
+        bars.add_sample(value);
+        bars.draw(canvas);
+    }
+    EXPECT_EQ(bars.full_redraws(), 1u);
+    EXPECT_EQ(column_height(frame, 0), 2);
+    EXPECT_EQ(column_height(frame, 1), 1);
+    EXPECT_EQ(column_height(frame, 2), 3);
+    EXPECT_EQ(column_height(frame, 3), 4);
+}
+
+/* test that autoscaling redraws the plot only when the range changes */
+TEST(chart_tests, test_autoscale_redraws_on_range_change) {
+    graphics::framebuffer frame{4, 4};
+    graphics::canvas canvas{&frame};
+    graphics::bar_chart bars{{0, 0}, 4, 4, 1, 0, graphics::pixel{255, 255, 255}};
+
+    for ( float value : {0.0f, 6.0f, 3.0f} ) {
+        bars.add_sample(value);
+        bars.draw(canvas);
+    }
+    EXPECT_EQ(bars.full_redraws(), 2u);
+    EXPECT_EQ(column_height(frame, 3), 3);
+
+    bars.add_sample(12.0f);
+    bars.draw(canvas);
+    EXPECT_EQ(bars.full_redraws(), 3u);
+    EXPECT_EQ(column_height(frame, 2), 2);
+    EXPECT_EQ(column_height(frame, 3), 4);
+}
+
+/* test that the sparkline joins consecutive samples and bar gaps are left unlit */
+TEST(chart_tests, test_sparkline_and_bar_gap) {
+    graphics::framebuffer frame{8, 4};
+    graphics::canvas canvas{&frame};
+    graphics::sparkline line{{0, 0}, 4, 4, graphics::pixel{255, 0, 0}};
+    line.set_range(0, 3);
+    line.add_sample(0);
+    line.add_sample(3);
+    line.draw(canvas);
+    EXPECT_EQ(column_height(frame, 2), 1);
+    EXPECT_EQ(column_height(frame, 3), 4);
+
+    graphics::bar_chart bars{{4, 0}, 4, 4, 1, 1, graphics::pixel{0, 255, 0}};
+    bars.set_range(0, 3);
+    bars.add_sample(3);
+    bars.add_sample(3);
+    bars.draw(canvas);
+    EXPECT_EQ(bars.samples().capacity(), 2u);
+    EXPECT_EQ(column_height(frame, 4), 0);
+    EXPECT_EQ(column_height(frame, 5), 4);
+    EXPECT_EQ(column_height(frame, 6), 0);
+    EXPECT_EQ(column_height(frame, 7), 4);
+}
@@ -0,0 +1,124 @@
+/**
+ * \file display_list_tests.cpp
+ * \brief unit tests for compiling JSON scene descriptions into display lists
+ * \version 0.1
+ * \date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+
+/********************************** Includes *******************************************/
+#include "gtest/gtest.h"
+#include "canvas.hpp"
+#include "display_list.hpp"
+#include "font.hpp"
+#include "framebuffer.hpp"
+#include <memory>
+
+using namespace graphics;
+
+/******************************** Local Functions **************************************/
+/* create a character of a tiny test font */
+static fonts::character make_character(uint16_t encoding, std::vector<uint32_t>&& bitmap) {
+    return fonts::character{fonts::character_properties{encoding, {0, 0}, {3, 0}, fonts::bounding_box{3, 2, 0, 0}}, std::move(bitmap)};
+}
+
+/* font of a blank space and an A that is lit at 0 and 2 on the top row and 0 to 2 on the bottom row */
+static fonts::font make_font() {
+    return fonts::font{std::vector<fonts::character>{make_character(' ', {0x00, 0x00}), make_character('A', {0xA0, 0xE0})}};
+}
+
+
+/****************************** Unit Tests ***********************************/
+/* test that shapes compile into spans at absolute positions, merged into one command per color run */
+TEST(display_list_tests, test_compile_shapes) {
+    auto description = json::parse(R"({
+        "background": [0, 0, 10],
+        "elements": [
+            {"type": "fill", "x": 1, "y": 1, "width": 3, "height": 2, "color": [255, 0, 0]},
+            {"type": "line", "x0": 0, "y0": 5, "x1": 7, "y1": 5, "color": [255, 0, 0]},
+            {"type": "rectangle", "x": 4, "y": 0, "width": 4, "height": 4, "color": [0, 255, 0]}
+        ]})");
+
+    auto list = display_list::from_json(description, font_table{});
+    ASSERT_TRUE(list);
+    ASSERT_EQ(list.get_value().commands().size(), 3u);
+    EXPECT_EQ(list.get_value().commands()[0].op, display_op::clear);
+    EXPECT_EQ(list.get_value().commands()[1].count, 3u);
+
+    framebuffer frame{8, 8};
+    canvas canvas{&frame};
+    list.get_value().execute(canvas);
+    EXPECT_EQ(frame.get_pixel(0, 0), pack(0, 0, 10));
+    EXPECT_EQ(frame.get_pixel(1, 1), pack(255, 0, 0));
+    EXPECT_EQ(frame.get_pixel(3, 2), pack(255, 0, 0));
+    EXPECT_EQ(frame.get_pixel(7, 5), pack(255, 0, 0));
+    EXPECT_EQ(frame.get_pixel(4, 0), pack(0, 255, 0));
+    EXPECT_EQ(frame.get_pixel(5, 1), pack(0, 0, 10));
+}
+
+/* test that text is aligned in its box and its glyphs compiled to spans */
+TEST(display_list_tests, test_compile_text) {
+    auto font = make_font();
+    auto description = json::parse(R"({
+        "elements": [
+            {"type": "text", "text": "AA", "font": "tiny", "x": 0, "y": 0, "width": 10, "height": 4,
+             "align": "center", "valign": "bottom", "color": [1, 2, 3]}
+        ]})");
+
+    auto list = display_list::from_json(description, font_table{{"tiny", &font}});
+    ASSERT_TRUE(list);
+
+    // two glyphs with two spans on the top row and one on the bottom row each
+    EXPECT_EQ(list.get_value().spans().size(), 6u);
+
+    framebuffer frame{10, 4};
+    canvas canvas{&frame};
+    list.get_value().execute(canvas);
+    EXPECT_EQ(frame.get_pixel(2, 2), pack(1, 2, 3));
+    EXPECT_EQ(frame.get_pixel(3, 2), 0u);
+    EXPECT_EQ(frame.get_pixel(7, 3), pack(1, 2, 3));
+    EXPECT_EQ(frame.get_pixel(8, 3), 0u);
+}
+
+/* test that invalid descriptions are reported instead of compiled */
+TEST(display_list_tests, test_invalid_descriptions) {
+    EXPECT_FALSE(display_list::from_json(json::parse(R"({"background": [0, 0, 0]})"), font_table{}));
+    EXPECT_FALSE(display_list::from_json(json::parse(R"({"elements": [{"type": "star", "color": [1, 1, 1]}]})"), font_table{}));
+    EXPECT_FALSE(display_list::from_json(json::parse(R"({"elements": [{"type": "fill", "width": 2}]})"), font_table{}));
+    EXPECT_FALSE(display_list::from_json(json::parse(R"({"elements": [{"type": "text", "font": "none", "color": [1, 1, 1]}]})"), font_table{}));
+    EXPECT_FALSE(display_list::from_json(json::parse(R"({"elements": [{"type": "fill", "x": "left", "color": [1, 1, 1]}]})"), font_table{}));
+    EXPECT_FALSE(display_list::from_json(json::parse(R"({"elements": [{"type": "fill", "width": 10, "height": 1e9, "color": [1, 1, 1]}]})"), font_table{}));
+    EXPECT_FALSE(display_list::from_json(json::parse(R"({"elements": [{"type": "circle", "radius": 5000, "color": [1, 1, 1]}]})"), font_table{}));
+    EXPECT_FALSE(display_list::from_json(json::parse(R"({"elements": [{"type": "line", "x1": -40000, "color": [1, 1, 1]}]})"), font_table{}));
+    EXPECT_FALSE(display_list::from_json(json::parse(R"({"elements": [{"type": "rectangle", "width": -1, "color": [1, 1, 1]}]})"), font_table{}));
+    EXPECT_FALSE(display_list::from_json(json::parse(R"({"background": [300, 0, 0], "elements": []})"), font_table{}));
+    EXPECT_FALSE(display_list::from_json(json::parse(R"({"elements": [{"type": "fill", "color": [1, -1, 1]}]})"), font_table{}));
+    EXPECT_FALSE(display_list::from_json(json::parse(R"({"elements": [{"type": "fill", "color": [1, 1, 0.5]}]})"), font_table{}));
+
+    // text that runs past max_extent, at 3 pixels a character
+    auto font = make_font();
+    json text_element = {{"type", "text"}, {"text", std::string(display_list::max_extent / 3 + 1, 'A')}, {"font", "tiny"}, {"color", {1, 1, 1}}};
+    EXPECT_FALSE(display_list::from_json(json{{"elements", {text_element}}}, font_table{{"tiny", &font}}));
+}
+
+/* test that switching layouts replaces what is drawn */
+TEST(display_list_tests, test_layout_switcher) {
+    layout_switcher layouts;
+    framebuffer frame{4, 4};
+    canvas canvas{&frame};
+    EXPECT_FALSE(layouts.execute(canvas));
+
+    auto red = display_list::from_json(json::parse(R"({"background": [255, 0, 0], "elements": []})"), font_table{});
+    auto blue = display_list::from_json(json::parse(R"({"background": [0, 0, 255], "elements": []})"), font_table{});
+    layouts.set(std::make_shared<const display_list>(red.get_value()));
+    EXPECT_TRUE(layouts.execute(canvas));
+    EXPECT_EQ(frame.get_pixel(2, 2), pack(255, 0, 0));
+
+    layouts.set(std::make_shared<const display_list>(blue.get_value()));
+    EXPECT_TRUE(layouts.execute(canvas));
+    EXPECT_EQ(frame.get_pixel(2, 2), pack(0, 0, 255));
+    EXPECT_EQ(layouts.generation(), 2u);
+}
@@ -0,0 +1,146 @@
+/**
+ * \file effects_tests.cpp
+ * \brief unit tests for the procedural effects and their lookup tables
+ * \version 0.1
+ * \date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+
+/********************************** Includes *******************************************/
+#include "gtest/gtest.h"
+#include "canvas.hpp"
+#include "effect_tables.hpp"
+#include "fire.hpp"
+#include "framebuffer.hpp"
+#include "gradient_sweep.hpp"
+#include "plasma.hpp"
+#include "starfield.hpp"
+#include <algorithm>
+#include <vector>
+
+/******************************** Local Functions **************************************/
+static int lit_pixels(const graphics::framebuffer& frame) {
+    return static_cast<int>(std::count_if(frame.data(), frame.data() + frame.size(), [](auto color) { return color != 0; }));
+}
+
+
+/****************************** Unit Tests ***********************************/
+/* test the sine table at the quarter turns */
+TEST(effects_tests, test_sin8_table) {
+    static_assert(graphics::sin8(0) == 128);
+    static_assert(graphics::sin8(64) == 255);
+    static_assert(graphics::sin8(128) == 128);
+    static_assert(graphics::sin8(192) == 1);
+}
+
+/* test that palettes hit their stops exactly and interpolate between them */
+TEST(effects_tests, test_palette_interpolation) {
+    constexpr auto colors = graphics::make_palette(std::array<graphics::palette_stop, 3>{{
+        {0, {0, 0, 0}}, {128, {255, 0, 0}}, {255, {255, 255, 255}}
+    }});
+    EXPECT_EQ(colors[0], graphics::pack(0, 0, 0));
+    EXPECT_EQ(colors[64], graphics::pack(127, 0, 0));
+    EXPECT_EQ(colors[128], graphics::pack(255, 0, 0));
+    EXPECT_EQ(colors[255], graphics::pack(255, 255, 255));
+    EXPECT_EQ(graphics::fire_palette[0], graphics::pack(0, 0, 0));
+}
+
+/* test that the gradient sweep steps through the palette along the row and moves with time */
+TEST(effects_tests, test_gradient_sweep) {
+    graphics::gradient_sweep sweep{{0, 0}, 4, 2, graphics::rainbow_palette, 256, 512};
+    const auto& frame = sweep.render_frame();
+    EXPECT_EQ(frame.get_pixel(0, 0), graphics::rainbow_palette[0]);
+    EXPECT_EQ(frame.get_pixel(3, 0), graphics::rainbow_palette[3]);
+    EXPECT_EQ(frame.get_pixel(1, 1), graphics::rainbow_palette[3]);
+
+    sweep.advance(80);
+    sweep.render_frame();
+    EXPECT_EQ(frame.get_pixel(0, 0), graphics::rainbow_palette[10]);
+}
+
+/* test that the plasma is a pure function of time */
+TEST(effects_tests, test_plasma_is_deterministic) {
+    graphics::plasma first{{0, 0}, 16, 8};
+    graphics::plasma second{{0, 0}, 16, 8};
+    first.advance(500);
+    second.advance(500);
+    const auto& a = first.render_frame();
+    const auto& b = second.render_frame();
+    EXPECT_TRUE(std::equal(a.data(), a.data() + a.size(), b.data()));
+
+    first.advance(100);
+    first.render_frame();
+    EXPECT_FALSE(std::equal(a.data(), a.data() + a.size(), b.data()));
+}
+
+/* test that the fire heats up from the bottom of the effect */
+TEST(effects_tests, test_fire_rises) {
+    graphics::fire flames{{0, 0}, 16, 16};
+    for ( int i = 0; i < 32; i++ ) {
+        flames.render_frame();
+    }
+    const auto& frame = flames.render_frame();
+    auto row_heat = [&frame](int y) {
+        int heat = 0;
+        for ( int x = 0; x < frame.width(); x++ ) {
+            heat += graphics::red_channel(frame.get_pixel(x, y));
+        }
+        return heat;
+    };
+    EXPECT_GT(row_heat(15), row_heat(8));
+    EXPECT_GT(row_heat(8), row_heat(0));
+}
+
+/* test that the starfield draws its stars and keeps them on the panel */
+TEST(effects_tests, test_starfield_draws_stars) {
+    graphics::starfield stars{{0, 0}, 32, 16, 40, 1};
+    for ( int i = 0; i < 10; i++ ) {
+        stars.advance(16);
+        const auto& frame = stars.render_frame();
+        EXPECT_LE(lit_pixels(frame), 40);
+    }
+    EXPECT_GT(lit_pixels(stars.render_frame()), 0);
+}
+
+/* test that effects draw at their origin and record their render cost */
+TEST(effects_tests, test_draw_and_cost) {
+    graphics::framebuffer frame{8, 8};
+    graphics::canvas canvas{&frame};
+    graphics::gradient_sweep sweep{{2, 3}, 4, 2, graphics::ocean_palette, 256, 0};
+
+    sweep.draw(canvas);
+    sweep.draw(canvas);
+    EXPECT_EQ(frame.get_pixel(2, 3), graphics::ocean_palette[0]);
+    EXPECT_EQ(frame.get_pixel(5, 4), graphics::ocean_palette[3]);
+    EXPECT_EQ(frame.get_pixel(1, 3), 0u);
+    EXPECT_EQ(frame.get_pixel(2, 5), 0u);
+
+    auto cost = sweep.cost();
+    EXPECT_EQ(cost.frames, 2u);
+    EXPECT_GE(cost.peak_us, cost.last_us);
+    sweep.reset_cost();
+    EXPECT_EQ(sweep.cost().frames, 0u);
+}
+
+/* test that a reduced resolution effect renders a smaller frame and scales it up to its full size */
+TEST(effects_tests, test_reduced_resolution) {
+    graphics::framebuffer frame{8, 8};
+    graphics::canvas canvas{&frame};
+    graphics::gradient_sweep sweep{{1, 1}, 4, 3, graphics::rainbow_palette, 256, 0};
+    sweep.set_resolution(2);
+    EXPECT_EQ(sweep.resolution(), 2u);
+    EXPECT_EQ(sweep.render_frame().width(), 2);
+    EXPECT_EQ(sweep.render_frame().height(), 2);
+
+    sweep.draw(canvas);
+    EXPECT_EQ(frame.get_pixel(1, 1), graphics::rainbow_palette[0]);
+    EXPECT_EQ(frame.get_pixel(2, 2), graphics::rainbow_palette[0]);
+    EXPECT_EQ(frame.get_pixel(3, 1), graphics::rainbow_palette[1]);
+    EXPECT_EQ(frame.get_pixel(4, 3), graphics::rainbow_palette[1]);
+    EXPECT_EQ(frame.get_pixel(5, 1), 0u);
+    EXPECT_EQ(frame.get_pixel(1, 4), 0u);
+    EXPECT_EQ(sweep.bounds().width, 4);
+}
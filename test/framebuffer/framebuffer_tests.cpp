@@ -0,0 +1,166 @@
+/**
+ * \file framebuffer_tests.cpp
+ * \brief unit tests for the packed and planar frame buffers, their kernels and canvas scrolling
+ * \version 0.1
+ * \date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+
+/********************************** Includes *******************************************/
+#include "gtest/gtest.h"
+#include "canvas.hpp"
+#include "framebuffer.hpp"
+#include "kernels.hpp"
+#include "pixel.hpp"
+#include "planar_framebuffer.hpp"
+
+
+/****************************** Unit Tests ***********************************/
+/* test that pixels pack and unpack at compile time */
+TEST(framebuffer_tests, test_pack_and_unpack_pixel) {
+    constexpr graphics::pixel color{255, 128, 1};
+    static_assert(graphics::pack(color) == 0x00FF8001);
+    static_assert(graphics::unpack(graphics::pack(color)) == color);
+    ASSERT_EQ(0x00FF8001u, graphics::pack(color));
+}
+
+/* test that the frame buffer ignores writes outside of the frame */
+TEST(framebuffer_tests, test_set_pixel_out_of_bounds_is_ignored) {
+    graphics::framebuffer frame{4, 2};
+    frame.SetPixel(-1, 0, 255, 255, 255);
+    frame.SetPixel(4, 1, 255, 255, 255);
+    frame.SetPixel(3, 1, 1, 2, 3);
+    ASSERT_EQ(graphics::pack(1, 2, 3), frame.get_pixel(3, 1));
+    ASSERT_EQ(0u, frame.get_pixel(0, 0));
+}
+
+/* test that the frame storage is aligned for vector loads */
+TEST(framebuffer_tests, test_storage_is_aligned) {
+    graphics::framebuffer frame{7, 3};
+    graphics::planar_framebuffer planar{7, 3};
+    ASSERT_EQ(0u, reinterpret_cast<uintptr_t>(frame.data()) % 16);
+    ASSERT_EQ(0u, reinterpret_cast<uintptr_t>(planar.green_plane().data()) % 16);
+}
+
+/* test converting between packed and planar layouts round trips */
+TEST(framebuffer_tests, test_layout_conversion_round_trip) {
+    graphics::framebuffer frame{3, 3};
+    graphics::planar_framebuffer planar{3, 3};
+    graphics::framebuffer result{3, 3};
+    frame.SetPixel(1, 2, 10, 20, 30);
+    graphics::kernels::to_planar(frame, planar);
+    ASSERT_EQ((graphics::pixel{10, 20, 30}), planar.get_pixel(1, 2));
+    graphics::kernels::to_packed(planar, result);
+    ASSERT_EQ(frame.get_pixel(1, 2), result.get_pixel(1, 2));
+}
+
+/* test blending with full and zero alpha selects the source and destination */
+TEST(framebuffer_tests, test_blend_alpha_limits) {
+    graphics::framebuffer destination{2, 1};
+    graphics::framebuffer source{2, 1};
+    destination.Fill(10, 20, 30);
+    source.Fill(200, 100, 50);
+    graphics::kernels::blend(destination, source, 0);
+    ASSERT_EQ(graphics::pack(10, 20, 30), destination.get_pixel(0, 0));
+    graphics::kernels::blend(destination, source, 255);
+    ASSERT_EQ(graphics::pack(200, 100, 50), destination.get_pixel(1, 0));
+}
+
+/* test packed and planar blends agree */
+TEST(framebuffer_tests, test_packed_and_planar_blend_agree) {
+    graphics::framebuffer packed_destination{5, 1};
+    graphics::framebuffer packed_source{5, 1};
+    packed_destination.Fill(255, 0, 100);
+    packed_source.Fill(0, 255, 200);
+
+    graphics::planar_framebuffer planar_destination{5, 1};
+    graphics::planar_framebuffer planar_source{5, 1};
+    graphics::kernels::to_planar(packed_destination, planar_destination);
+    graphics::kernels::to_planar(packed_source, planar_source);
+
+    graphics::kernels::blend(packed_destination, packed_source, 128);
+    graphics::kernels::blend(planar_destination, planar_source, 128);
+    ASSERT_EQ(graphics::unpack(packed_destination.get_pixel(4, 0)), planar_destination.get_pixel(4, 0));
+}
+
+/* test scaling a frame */
+TEST(framebuffer_tests, test_scale) {
+    graphics::framebuffer frame{1, 1};
+    frame.Fill(255, 128, 2);
+    graphics::kernels::scale(frame, 255);
+    ASSERT_EQ(graphics::pack(255, 128, 2), frame.get_pixel(0, 0));
+    graphics::kernels::scale(frame, 0);
+    ASSERT_EQ(0u, frame.get_pixel(0, 0));
+}
+
+/* test scrolling part of a frame left and down with the exposed strips filled */
+TEST(framebuffer_tests, test_scroll_region) {
+    graphics::framebuffer frame{6, 4};
+    for ( int y = 0; y < 4; y++ ) {
+        for ( int x = 0; x < 6; x++ ) {
+            frame.SetPixel(x, y, 0, y, x + 1);
+        }
+    }
+    graphics::canvas canvas{&frame};
+
+    EXPECT_TRUE(canvas.scroll_region(graphics::rect{1, 0, 4, 4}, -1, 1, graphics::pixel{9, 9, 9}));
+
+    // outside of the area is untouched
+    EXPECT_EQ(frame.get_pixel(0, 1), graphics::pack(0, 1, 1));
+    EXPECT_EQ(frame.get_pixel(5, 1), graphics::pack(0, 1, 6));
+
+    // the top row and the right column of the area are exposed
+    EXPECT_EQ(frame.get_pixel(2, 0), graphics::pack(9, 9, 9));
+    EXPECT_EQ(frame.get_pixel(4, 2), graphics::pack(9, 9, 9));
+
+    // everything else moved one left and one down
+    EXPECT_EQ(frame.get_pixel(1, 1), graphics::pack(0, 0, 3));
+    EXPECT_EQ(frame.get_pixel(3, 3), graphics::pack(0, 2, 5));
+}
+
+/* test scrolling right and up, and scrolling past the size of the area */
+TEST(framebuffer_tests, test_scroll_region_other_directions) {
+    graphics::framebuffer frame{4, 4};
+    for ( int y = 0; y < 4; y++ ) {
+        for ( int x = 0; x < 4; x++ ) {
+            frame.SetPixel(x, y, 0, y, x);
+        }
+    }
+    graphics::canvas canvas{&frame};
+
+    canvas.scroll_region(graphics::rect{0, 0, 4, 4}, 2, -1, graphics::pixel{0, 0, 0});
+    EXPECT_EQ(frame.get_pixel(2, 0), graphics::pack(0, 1, 0));
+    EXPECT_EQ(frame.get_pixel(3, 2), graphics::pack(0, 3, 1));
+    EXPECT_EQ(frame.get_pixel(1, 1), 0u);
+    EXPECT_EQ(frame.get_pixel(3, 3), 0u);
+
+    canvas.scroll_region(graphics::rect{-2, -2, 8, 8}, 0, 10, graphics::pixel{1, 1, 1});
+    EXPECT_EQ(frame.get_pixel(0, 0), graphics::pack(1, 1, 1));
+    EXPECT_EQ(frame.get_pixel(3, 3), graphics::pack(1, 1, 1));
+}
+
+/* test that a clipped canvas never draws outside of its clip */
+TEST(framebuffer_tests, test_clipped_canvas) {
+    graphics::framebuffer frame{8, 4};
+    graphics::canvas canvas{&frame, graphics::rect{2, 1, 4, 2}};
+
+    canvas.set_pixel(0, 0, graphics::pixel{1, 1, 1});
+    canvas.set_pixel(3, 2, graphics::pixel{1, 1, 1});
+    canvas.fill_span(-4, 1, 20, graphics::pixel{2, 2, 2});
+    EXPECT_EQ(frame.get_pixel(0, 0), 0u);
+    EXPECT_EQ(frame.get_pixel(3, 2), graphics::pack(1, 1, 1));
+    EXPECT_EQ(frame.get_pixel(1, 1), 0u);
+    EXPECT_EQ(frame.get_pixel(2, 1), graphics::pack(2, 2, 2));
+    EXPECT_EQ(frame.get_pixel(5, 1), graphics::pack(2, 2, 2));
+    EXPECT_EQ(frame.get_pixel(6, 1), 0u);
+
+    // fill only covers the clip, and the canvas still reports the full frame size
+    canvas.fill(3, 3, 3);
+    EXPECT_EQ(frame.get_pixel(2, 2), graphics::pack(3, 3, 3));
+    EXPECT_EQ(frame.get_pixel(2, 3), 0u);
+    EXPECT_EQ(canvas.width(), 8);
+    EXPECT_EQ(canvas.height(), 4);
+}
@@ -0,0 +1,116 @@
+/**
+ * \file interval_timer_tests.cpp
+ * \brief unit tests for the interval timer schedule, engine and lateness histogram
+ * \version 0.1
+ * \date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+
+/********************************** Includes *******************************************/
+#include "gtest/gtest.h"
+#include "interval_timer.hpp"
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+
+/****************************** Unit Tests ***********************************/
+/* test parsing the settings sent by the socket test script */
+TEST(interval_timer_tests, test_parse_settings) {
+    auto message = nlohmann::json::parse(R"({"total_intervals": 6, "high_interval_ms": 7000, "low_interval_ms": 3000,
+                                             "warmup_interval_ms": 600000, "cooldown_interval_ms": 300000, "repeat_times": 6})");
+    auto settings = intervals::interval_settings::from_json(message);
+    ASSERT_TRUE(settings);
+    EXPECT_EQ(settings.get_value().high, 7000ms);
+    EXPECT_EQ(settings.get_value().warmup, 600000ms);
+    EXPECT_EQ(settings.get_value().repeat_times, 6);
+
+    EXPECT_FALSE(intervals::interval_settings::from_json(nlohmann::json::parse(R"({"high_interval_ms": 7000})")));
+    EXPECT_FALSE(intervals::interval_settings::from_json(nlohmann::json::parse(R"({"high_interval_ms": -1, "low_interval_ms": 0, "total_intervals": 1})")));
+}
+
+/* test that optional fields of the wrong type and absurd counts are rejected rather than thrown or allocated */
+TEST(interval_timer_tests, test_parse_rejects_bad_values) {
+    auto parse = [](const char* text) { return intervals::interval_settings::from_json(nlohmann::json::parse(text)); };
+    EXPECT_FALSE(parse(R"({"high_interval_ms": 1, "low_interval_ms": 1, "total_intervals": 1, "repeat_times": "six"})"));
+    EXPECT_FALSE(parse(R"({"high_interval_ms": 1, "low_interval_ms": 1, "total_intervals": 1, "warmup_interval_ms": 1.5})"));
+    EXPECT_FALSE(parse(R"({"high_interval_ms": 1, "low_interval_ms": 1, "total_intervals": 1000000000})"));
+    EXPECT_FALSE(parse(R"({"high_interval_ms": 1, "low_interval_ms": 1, "total_intervals": 100, "repeat_times": 100})"));
+    EXPECT_FALSE(parse(R"({"high_interval_ms": 100000000000, "low_interval_ms": 1, "total_intervals": 1})"));
+    EXPECT_TRUE(parse(R"({"high_interval_ms": 1, "low_interval_ms": 1, "total_intervals": 10, "repeat_times": 100})"));
+}
+
+/* test that the schedule lays out every phase back to back with no drift over an hour */
+TEST(interval_timer_tests, test_schedule_has_no_drift) {
+    intervals::interval_settings settings{50000ms, 10000ms, 0ms, 0ms, 60, 1};
+    auto start = intervals::clock::now();
+    auto schedule = intervals::build_schedule(settings, start);
+
+    ASSERT_EQ(schedule.size(), 120u);
+    EXPECT_EQ(schedule.front().kind, intervals::phase_kind::high);
+    EXPECT_EQ(schedule.back().kind, intervals::phase_kind::low);
+    EXPECT_EQ(schedule.back().interval, 60);
+    EXPECT_EQ(schedule.back().end, start + 60min);
+    for ( std::size_t i = 1; i < schedule.size(); i++ ) {
+        EXPECT_EQ(schedule[i].start, schedule[i - 1].end);
+    }
+}
+
+/* test that warmup and cooldown wrap the sets and empty phases are left out */
+TEST(interval_timer_tests, test_schedule_phases) {
+    intervals::interval_settings settings{7000ms, 0ms, 5000ms, 3000ms, 2, 2};
+    auto start = intervals::clock::now();
+    auto schedule = intervals::build_schedule(settings, start);
+
+    ASSERT_EQ(schedule.size(), 6u);
+    EXPECT_EQ(schedule[0].kind, intervals::phase_kind::warmup);
+    EXPECT_EQ(schedule[3].repeat, 2);
+    EXPECT_EQ(schedule[3].interval, 1);
+    EXPECT_EQ(schedule[5].kind, intervals::phase_kind::cooldown);
+    EXPECT_EQ(schedule[5].end, start + 36s);
+}
+
+/* test that transitions record their lateness and a late update does not shift later phases */
+TEST(interval_timer_tests, test_transitions_record_lateness) {
+    intervals::interval_settings settings{2000ms, 1000ms, 0ms, 0ms, 2, 1};
+    auto start = intervals::clock::now();
+    intervals::interval_timer timer;
+    timer.start(settings, start);
+
+    EXPECT_FALSE(timer.update(start + 1999ms));
+    EXPECT_TRUE(timer.update(start + 2000ms + 100us));
+    EXPECT_EQ(timer.current()->kind, intervals::phase_kind::low);
+
+    // an update that misses a whole phase records both transitions and lands on the right phase
+    EXPECT_TRUE(timer.update(start + 5000ms + 3ms));
+    EXPECT_EQ(timer.current()->kind, intervals::phase_kind::low);
+    EXPECT_EQ(timer.current()->end, start + 6000ms);
+
+    auto& lateness = timer.lateness();
+    EXPECT_EQ(lateness.count(), 3u);
+    EXPECT_EQ(lateness.bucket(0), 1u);
+    EXPECT_EQ(lateness.bucket(4), 1u);
+    EXPECT_EQ(lateness.max(), std::chrono::microseconds{2003000});
+    EXPECT_EQ(lateness.bucket(intervals::lateness_histogram::bucket_count - 1), 1u);
+
+    timer.update(start + 6000ms);
+    EXPECT_FALSE(timer.is_running());
+    EXPECT_FALSE(timer.next_deadline(start + 6000ms));
+}
+
+/* test that the countdown wakes on whole seconds measured from the end of the phase */
+TEST(interval_timer_tests, test_countdown_deadlines) {
+    intervals::interval_settings settings{2500ms, 1000ms, 0ms, 0ms, 1, 1};
+    auto start = intervals::clock::now();
+    intervals::interval_timer timer;
+    timer.start(settings, start);
+
+    EXPECT_EQ(timer.remaining_seconds(start), 3);
+    EXPECT_EQ(*timer.next_deadline(start), start + 500ms);
+    EXPECT_EQ(timer.remaining_seconds(start + 500ms), 2);
+    EXPECT_EQ(*timer.next_deadline(start + 500ms), start + 1500ms);
+    EXPECT_EQ(*timer.next_deadline(start + 2000ms), start + 2500ms);
+}
@@ -0,0 +1,110 @@
+/**
+ * \file static_layer_tests.cpp
+ * \brief unit tests for cached static layers
+ * \version 0.1
+ * \date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+
+/********************************** Includes *******************************************/
+#include "gtest/gtest.h"
+#include "canvas.hpp"
+#include "framebuffer.hpp"
+#include "rectangle.hpp"
+#include "static_layer.hpp"
+#include "text_box.hpp"
+#include <memory>
+
+
+/****************************** Unit Tests ***********************************/
+/* test that the layer renders once and is then only copied */
+TEST(static_layer_tests, test_renders_once) {
+    graphics::framebuffer frame{8, 8};
+    graphics::canvas canvas{&frame};
+    graphics::static_layer layer{{2, 2}, 4, 4};
+    layer.add(std::make_shared<graphics::rectangle>(graphics::origin{0, 0}, 4, 4, graphics::pixel{255, 0, 0}));
+
+    for ( int i = 0; i < 5; i++ ) {
+        frame.Clear();
+        layer.draw(canvas);
+    }
+    EXPECT_EQ(layer.render_count(), 1u);
+    EXPECT_EQ(frame.get_pixel(2, 2), graphics::pack(255, 0, 0));
+    EXPECT_EQ(frame.get_pixel(5, 5), graphics::pack(255, 0, 0));
+    EXPECT_EQ(frame.get_pixel(6, 6), 0u);
+}
+
+/* test that changing a cached shape re-renders the layer */
+TEST(static_layer_tests, test_shape_change_invalidates) {
+    graphics::framebuffer frame{4, 4};
+    graphics::canvas canvas{&frame};
+    graphics::static_layer layer{{0, 0}, 4, 4};
+    auto box = std::make_shared<graphics::rectangle>(graphics::origin{0, 0}, 2, 2, graphics::pixel{0, 255, 0}, true);
+    layer.add(box);
+
+    layer.draw(canvas);
+    EXPECT_FALSE(layer.is_stale());
+    box->set_color(graphics::pixel{0, 0, 255});
+    EXPECT_TRUE(layer.is_stale());
+    layer.draw(canvas);
+    EXPECT_EQ(layer.render_count(), 2u);
+    EXPECT_EQ(frame.get_pixel(1, 1), graphics::pack(0, 0, 255));
+
+    layer.invalidate();
+    layer.draw(canvas);
+    EXPECT_EQ(layer.render_count(), 3u);
+}
+
+/* test that unlit pixels of a transparent layer keep what is underneath, and opaque layers overwrite them */
+TEST(static_layer_tests, test_transparency) {
+    graphics::framebuffer frame{4, 4};
+    graphics::canvas canvas{&frame};
+    auto outline = std::make_shared<graphics::rectangle>(graphics::origin{0, 0}, 4, 4, graphics::pixel{255, 255, 255});
+
+    graphics::static_layer transparent{{0, 0}, 4, 4};
+    transparent.add(outline);
+    frame.Fill(0, 0, 9);
+    transparent.draw(canvas);
+    EXPECT_EQ(frame.get_pixel(0, 0), graphics::pack(255, 255, 255));
+    EXPECT_EQ(frame.get_pixel(1, 1), graphics::pack(0, 0, 9));
+
+    graphics::static_layer opaque{{0, 0}, 4, 4, true};
+    opaque.add(outline);
+    frame.Fill(0, 0, 9);
+    opaque.draw(canvas);
+    EXPECT_EQ(frame.get_pixel(1, 1), 0u);
+}
+
+/* test that changing a cached text box through its setters re-renders the layer */
+TEST(static_layer_tests, test_text_change_invalidates) {
+    graphics::framebuffer frame{4, 4};
+    graphics::canvas canvas{&frame};
+    graphics::static_layer layer{{0, 0}, 4, 4};
+    std::vector<graphics::fonts::character> characters;
+    characters.emplace_back(graphics::fonts::character_properties{'|', {0, 0}, {2, 0}, graphics::fonts::bounding_box{2, 2, 0, 0}},
+                            std::vector<uint32_t>{0xc0, 0xc0});
+    auto text = std::make_shared<graphics::text_box>(characters, graphics::origin{0, 0}, graphics::pixel{255, 0, 0}, 4, 4);
+    layer.add(text);
+
+    layer.draw(canvas);
+    EXPECT_EQ(frame.get_pixel(1, 1), graphics::pack(255, 0, 0));
+    text->set_color(graphics::pixel{0, 0, 255});
+    EXPECT_TRUE(layer.is_stale());
+    layer.draw(canvas);
+    EXPECT_EQ(frame.get_pixel(1, 1), graphics::pack(0, 0, 255));
+
+    text->set_alignment(graphics::horizontal_alignment::right, graphics::vertical_alignment::bottom);
+    frame.Clear();
+    layer.draw(canvas);
+    EXPECT_EQ(layer.render_count(), 3u);
+    EXPECT_EQ(frame.get_pixel(3, 3), graphics::pack(0, 0, 255));
+    EXPECT_EQ(frame.get_pixel(1, 1), 0u);
+
+    text->set_text({});
+    frame.Clear();
+    layer.draw(canvas);
+    EXPECT_EQ(frame.get_pixel(3, 3), 0u);
+}
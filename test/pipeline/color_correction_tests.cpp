@@ -0,0 +1,66 @@
+/**
+ * \file color_correction_tests.cpp
+ * \brief unit tests for the color correction frame stage
+ * \version 0.1
+ * \date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+
+/********************************** Includes *******************************************/
+#include "gtest/gtest.h"
+#include "color_correction.hpp"
+#include "frame_pipeline.hpp"
+#include "framebuffer.hpp"
+#include <memory>
+
+
+/****************************** Unit Tests ***********************************/
+/* test the default tables are generated at compile time and hit both end points */
+TEST(color_correction_tests, test_default_luts_are_constexpr) {
+    static_assert(graphics::default_color_luts.red[0] == 0);
+    static_assert(graphics::default_color_luts.red[255] == 255);
+    ASSERT_LT(graphics::default_color_luts.green[128], 128);
+}
+
+/* test a unity gamma with unity gains is the identity */
+TEST(color_correction_tests, test_unity_settings_are_identity) {
+    constexpr auto lut = graphics::make_channel_lut(1.0, 255, 255);
+    for ( int i = 0; i < 256; i++ ) {
+        ASSERT_EQ(i, lut[i]);
+    }
+}
+
+/* test the gamma curve matches the expected value for a mid-scale input */
+TEST(color_correction_tests, test_gamma_curve_value) {
+    constexpr auto lut = graphics::make_channel_lut(2.2, 255, 255);
+    // 255 * (128 / 255) ^ 2.2 = 55.98
+    ASSERT_EQ(56, lut[128]);
+}
+
+/* test brightness and white balance scale the output */
+TEST(color_correction_tests, test_brightness_and_white_balance) {
+    graphics::color_settings settings;
+    settings.red_gamma = settings.green_gamma = settings.blue_gamma = 1.0;
+    settings.white_balance = graphics::pixel{255, 128, 0};
+    settings.brightness = 128;
+    graphics::color_correction stage{settings};
+
+    graphics::framebuffer frame{1, 1};
+    frame.Fill(255, 255, 255);
+    stage.process(frame);
+    ASSERT_EQ(graphics::pack(128, 64, 0), frame.get_pixel(0, 0));
+}
+
+/* test the pipeline leaves the rendered frame untouched */
+TEST(color_correction_tests, test_pipeline_does_not_modify_source) {
+    graphics::frame_pipeline pipeline{2, 2};
+    pipeline.add_stage(std::make_shared<graphics::color_correction>());
+    graphics::framebuffer frame{2, 2};
+    frame.Fill(128, 128, 128);
+    auto& output = pipeline.process(frame);
+    ASSERT_EQ(graphics::pack(128, 128, 128), frame.get_pixel(0, 0));
+    ASSERT_EQ(graphics::pack(56, 56, 56), output.get_pixel(1, 1));
+}
@@ -0,0 +1,82 @@
+/**
+ * \file dithering_tests.cpp
+ * \brief unit tests for the dithering frame stage
+ * \version 0.1
+ * \date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+
+/********************************** Includes *******************************************/
+#include "gtest/gtest.h"
+#include "dithering.hpp"
+#include "framebuffer.hpp"
+
+
+/****************************** Unit Tests ***********************************/
+/* test the Bayer matrix is generated at compile time and is a permutation */
+TEST(dithering_tests, test_bayer_matrix_is_permutation) {
+    static_assert(graphics::bayer_value(0, 0) == 0);
+    static_assert(graphics::bayer_value(1, 1) == 16);
+    bool seen[64] = {};
+    for ( unsigned y = 0; y < graphics::bayer_size; y++ ) {
+        for ( unsigned x = 0; x < graphics::bayer_size; x++ ) {
+            seen[graphics::bayer_value(x, y)] = true;
+        }
+    }
+    for ( auto value : seen ) {
+        ASSERT_TRUE(value);
+    }
+}
+
+/* test a one bit panel with ordered dithering lights half of a mid-grey frame */
+TEST(dithering_tests, test_ordered_one_bit_mid_grey) {
+    graphics::dithering stage{8, 1, graphics::dither_mode::ordered};
+    graphics::framebuffer frame{8, 8};
+    frame.Fill(128, 128, 128);
+    stage.process(frame);
+
+    int lit = 0;
+    for ( std::size_t i = 0; i < frame.size(); i++ ) {
+        auto value = graphics::red_channel(frame.data()[i]);
+        ASSERT_TRUE((value == 0) || (value == 255));
+        lit += (value == 255) ? 1 : 0;
+    }
+    ASSERT_EQ(32, lit);
+}
+
+/* test the extremes are never dithered */
+TEST(dithering_tests, test_black_and_white_are_preserved) {
+    graphics::dithering stage{4, 2, graphics::dither_mode::temporal};
+    graphics::framebuffer frame{4, 4};
+    frame.SetPixel(0, 0, 255, 255, 255);
+    for ( int i = 0; i < 4; i++ ) {
+        stage.process(frame);
+        ASSERT_EQ(graphics::pack(255, 255, 255), frame.get_pixel(0, 0));
+        ASSERT_EQ(0u, frame.get_pixel(1, 1));
+    }
+}
+
+/* test temporal dithering averages to the input value over all slots */
+TEST(dithering_tests, test_temporal_average) {
+    graphics::dithering stage{1, 1, graphics::dither_mode::temporal};
+    int total = 0;
+    for ( unsigned slot = 0; slot < graphics::temporal_slots; slot++ ) {
+        graphics::framebuffer frame{1, 1};
+        frame.Fill(64, 64, 64);
+        stage.process(frame);
+        total += graphics::red_channel(frame.get_pixel(0, 0));
+    }
+    ASSERT_EQ(255, total);
+}
+
+/* test full depth panels are left untouched */
+TEST(dithering_tests, test_eight_bit_passthrough) {
+    graphics::dithering stage{2, 11, graphics::dither_mode::ordered};
+    graphics::framebuffer frame{2, 2};
+    frame.Fill(1, 2, 3);
+    stage.process(frame);
+    ASSERT_EQ(graphics::pack(1, 2, 3), frame.get_pixel(1, 1));
+}
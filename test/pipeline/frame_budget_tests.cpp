@@ -0,0 +1,155 @@
+/**
+ * \file frame_budget_tests.cpp
+ * \brief unit tests for the frame budget watchdog and its quality knobs
+ * \version 0.1
+ * \date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+/********************************** Includes *******************************************/
+#include "gtest/gtest.h"
+#include "dithering.hpp"
+#include "frame_budget.hpp"
+#include "frame_pipeline.hpp"
+#include "frame_presenter.hpp"
+#include "framebuffer.hpp"
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+
+/******************************** Local Functions **************************************/
+// Run a number of frames that each take a fixed time in the render phase
+static int run_frames(graphics::frame_budget& budget, int count, std::chrono::microseconds render) {
+    int changes = 0;
+    for ( int i = 0; i < count; i++ ) {
+        budget.add(graphics::frame_phase::render, render);
+        changes += budget.end_frame() ? 1 : 0;
+    }
+    return changes;
+}
+
+
+/****************************** Unit Tests ***********************************/
+/* test that sustained overruns step quality down knob by knob and single overruns do not */
+TEST(frame_budget_tests, test_steps_down_on_sustained_overruns) {
+    graphics::frame_budget budget{graphics::budget_settings{1000, 3, 10, 50}};
+    std::vector<unsigned> first_levels;
+    std::vector<unsigned> second_levels;
+    budget.add_knob(graphics::quality_knob{"first", 2, [&](unsigned level) { first_levels.push_back(level); }});
+    budget.add_knob(graphics::quality_knob{"second", 3, [&](unsigned level) { second_levels.push_back(level); }});
+    EXPECT_EQ(budget.max_level(), 3u);
+    EXPECT_EQ(first_levels, (std::vector<unsigned>{0}));
+
+    // isolated slow frames are tolerated
+    for ( int i = 0; i < 5; i++ ) {
+        EXPECT_EQ(run_frames(budget, 2, 1500us), 0);
+        EXPECT_EQ(run_frames(budget, 1, 800us), 0);
+    }
+    EXPECT_EQ(budget.level(), 0u);
+
+    EXPECT_EQ(run_frames(budget, 3, 1500us), 1);
+    EXPECT_EQ(budget.level(), 1u);
+    EXPECT_EQ(budget.knob_level(0), 1u);
+    EXPECT_EQ(budget.knob_level(1), 0u);
+
+    // the first knob is used up before the second is touched, and the lowest level is a floor
+    EXPECT_EQ(run_frames(budget, 12, 1500us), 2);
+    EXPECT_EQ(budget.level(), 3u);
+    EXPECT_EQ(first_levels, (std::vector<unsigned>{0, 1}));
+    EXPECT_EQ(second_levels, (std::vector<unsigned>{0, 1, 2}));
+
+    auto stats = budget.statistics();
+    EXPECT_EQ(stats.step_downs, 3u);
+    EXPECT_EQ(stats.overruns, 25u);
+}
+
+/* test that quality comes back after a run of frames with headroom, in reverse order */
+TEST(frame_budget_tests, test_steps_up_with_headroom) {
+    graphics::frame_budget budget{graphics::budget_settings{1000, 2, 4, 50}};
+    std::vector<unsigned> first_levels;
+    budget.add_knob(graphics::quality_knob{"first", 2, [&](unsigned level) { first_levels.push_back(level); }});
+    budget.add_knob(graphics::quality_knob{"second", 2, nullptr});
+    run_frames(budget, 4, 2000us);
+    EXPECT_EQ(budget.level(), 2u);
+
+    // frames inside the budget but above the headroom threshold hold the level
+    EXPECT_EQ(run_frames(budget, 20, 700us), 0);
+    EXPECT_EQ(run_frames(budget, 4, 400us), 1);
+    EXPECT_EQ(budget.knob_level(1), 0u);
+    EXPECT_EQ(budget.knob_level(0), 1u);
+    EXPECT_EQ(run_frames(budget, 4, 400us), 1);
+    EXPECT_EQ(budget.level(), 0u);
+    EXPECT_EQ(first_levels, (std::vector<unsigned>{0, 1, 0}));
+    EXPECT_EQ(budget.statistics().step_ups, 2u);
+}
+
+/* test that frames are counted against the level and knob levels they used */
+TEST(frame_budget_tests, test_level_usage) {
+    graphics::frame_budget budget{graphics::budget_settings{1000, 2, 100, 50}};
+    budget.add_knob(graphics::quality_knob{"only", 3, nullptr});
+    run_frames(budget, 2, 2000us);
+    run_frames(budget, 5, 900us);
+
+    EXPECT_EQ(budget.level_usage(), (std::vector<uint64_t>{2, 5, 0}));
+    EXPECT_EQ(budget.knob_usage(0), (std::vector<uint64_t>{2, 5, 0}));
+    EXPECT_EQ(budget.knob_name(0), "only");
+}
+
+/* test that phases are timed separately and the presenter times post-processing and upload but not the swap */
+TEST(frame_budget_tests, test_phase_timing) {
+    graphics::frame_budget budget{graphics::budget_settings{}};
+    budget.add(graphics::frame_phase::update, 100us);
+    budget.add(graphics::frame_phase::update, 50us);
+    budget.add(graphics::frame_phase::render, 300us);
+    budget.end_frame();
+    auto stats = budget.statistics();
+    EXPECT_EQ(stats.phases[static_cast<std::size_t>(graphics::frame_phase::update)].last_us, 150u);
+    EXPECT_EQ(stats.phases[static_cast<std::size_t>(graphics::frame_phase::render)].peak_us, 300u);
+
+    graphics::frame_pipeline pipeline{4, 4};
+    int presented = 0;
+    int swapped = 0;
+    graphics::frame_presenter presenter{pipeline,
+                                        [&](const graphics::framebuffer&) {
+                                            presented++;
+                                            std::this_thread::sleep_for(2ms);
+                                        },
+                                        [&]() {
+                                            swapped++;
+                                            std::this_thread::sleep_for(20ms);
+                                        }};
+    presenter.set_budget(&budget);
+    graphics::framebuffer frame{4, 4};
+    presenter.present(frame);
+    budget.end_frame();
+    stats = budget.statistics();
+    EXPECT_EQ(presented, 1);
+    EXPECT_EQ(swapped, 1);
+    EXPECT_GE(stats.phases[static_cast<std::size_t>(graphics::frame_phase::present)].last_us, 2000u);
+
+    // waiting for the panel's refresh in the swap is idle time, not frame cost
+    EXPECT_LT(stats.phases[static_cast<std::size_t>(graphics::frame_phase::present)].last_us, 20000u);
+    EXPECT_EQ(stats.phases[static_cast<std::size_t>(graphics::frame_phase::update)].last_us, 0u);
+    EXPECT_EQ(stats.frames, 2u);
+}
+
+/* test that the dithering stage can change mode while running */
+TEST(frame_budget_tests, test_dithering_mode_knob) {
+    graphics::dithering stage{8, 1, graphics::dither_mode::temporal};
+    EXPECT_TRUE(stage.is_temporal());
+    stage.set_mode(graphics::dither_mode::none);
+    EXPECT_FALSE(stage.is_temporal());
+    EXPECT_EQ(stage.mode(), graphics::dither_mode::none);
+
+    graphics::framebuffer frame{8, 8};
+    frame.Fill(100, 100, 100);
+    stage.process(frame);
+    EXPECT_EQ(frame.get_pixel(3, 5), graphics::pack(0, 0, 0));
+}
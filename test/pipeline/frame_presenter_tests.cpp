@@ -0,0 +1,84 @@
+/**
+ * \file frame_presenter_tests.cpp
+ * \brief unit tests for frame hashing and redundant frame skipping
+ * \version 0.1
+ * \date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+
+/********************************** Includes *******************************************/
+#include "gtest/gtest.h"
+#include "dithering.hpp"
+#include "frame_hash.hpp"
+#include "frame_pipeline.hpp"
+#include "frame_presenter.hpp"
+#include "framebuffer.hpp"
+#include <memory>
+
+
+/****************************** Unit Tests ***********************************/
+/* test the hash changes when a single pixel changes */
+TEST(frame_presenter_tests, test_hash_detects_single_pixel_change) {
+    graphics::framebuffer frame{13, 7};
+    auto initial = graphics::hash_frame(frame);
+    frame.SetPixel(12, 6, 0, 0, 1);
+    ASSERT_NE(initial, graphics::hash_frame(frame));
+    frame.SetPixel(12, 6, 0, 0, 0);
+    ASSERT_EQ(initial, graphics::hash_frame(frame));
+}
+
+/* test identical frames are skipped and counted */
+TEST(frame_presenter_tests, test_identical_frames_are_skipped) {
+    graphics::frame_pipeline pipeline{4, 4};
+    int uploads = 0;
+    graphics::frame_presenter presenter{pipeline, [&](const graphics::framebuffer&) { uploads++; }};
+    graphics::framebuffer frame{4, 4};
+
+    ASSERT_TRUE(presenter.present(frame));
+    ASSERT_FALSE(presenter.present(frame));
+    frame.SetPixel(1, 1, 255, 0, 0);
+    ASSERT_TRUE(presenter.present(frame));
+    ASSERT_FALSE(presenter.present(frame));
+
+    auto statistics = presenter.statistics();
+    ASSERT_EQ(2, uploads);
+    ASSERT_EQ(2u, statistics.presented);
+    ASSERT_EQ(2u, statistics.skipped);
+}
+
+/* test invalidating forces the next frame out */
+TEST(frame_presenter_tests, test_invalidate_forces_present) {
+    graphics::frame_pipeline pipeline{2, 2};
+    graphics::frame_presenter presenter{pipeline, [](const graphics::framebuffer&) {}};
+    graphics::framebuffer frame{2, 2};
+    presenter.present(frame);
+    presenter.invalidate();
+    ASSERT_TRUE(presenter.present(frame));
+}
+
+/* test frames are never skipped while a temporal stage is active */
+TEST(frame_presenter_tests, test_temporal_stages_disable_skipping) {
+    graphics::frame_pipeline pipeline{2, 2};
+    pipeline.add_stage(std::make_shared<graphics::dithering>(2, 1, graphics::dither_mode::temporal));
+    graphics::frame_presenter presenter{pipeline, [](const graphics::framebuffer&) {}};
+    graphics::framebuffer frame{2, 2};
+    presenter.present(frame);
+    ASSERT_TRUE(presenter.present(frame));
+}
+
+/* test a change to a stage's settings forces an unchanged frame out again */
+TEST(frame_presenter_tests, test_stage_changes_force_present) {
+    graphics::frame_pipeline pipeline{2, 2};
+    auto dither = std::make_shared<graphics::dithering>(2, 1, graphics::dither_mode::ordered);
+    pipeline.add_stage(dither);
+    graphics::frame_presenter presenter{pipeline, [](const graphics::framebuffer&) {}};
+    graphics::framebuffer frame{2, 2};
+    presenter.present(frame);
+    ASSERT_FALSE(presenter.present(frame));
+    dither->set_mode(graphics::dither_mode::none);
+    ASSERT_TRUE(presenter.present(frame));
+    ASSERT_FALSE(presenter.present(frame));
+}
@@ -0,0 +1,104 @@
+/**
+ * \file frame_snapshot_tests.cpp
+ * \brief unit tests for presented frame snapshots and their encodings
+ * \version 0.1
+ * \date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+
+/********************************** Includes *******************************************/
+#include "gtest/gtest.h"
+#include "frame_pipeline.hpp"
+#include "frame_presenter.hpp"
+#include "frame_snapshot.hpp"
+#include "framebuffer.hpp"
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+
+
+/****************************** Unit Tests ***********************************/
+/* test that reads return the latest published frame and its number */
+TEST(frame_snapshot_tests, test_read_latest_frame) {
+    graphics::frame_snapshot snapshot{2, 2};
+    graphics::framebuffer frame{2, 2};
+    graphics::framebuffer copy{2, 2};
+    EXPECT_EQ(snapshot.read(copy), 0u);
+
+    for ( uint8_t value = 1; value <= 3; value++ ) {
+        frame.Fill(value, 0, 0);
+        snapshot.publish(frame);
+    }
+    EXPECT_EQ(snapshot.read(copy), 3u);
+    EXPECT_EQ(copy.get_pixel(1, 1), graphics::pack(3, 0, 0));
+
+    // reading again without a new frame returns the same frame
+    EXPECT_EQ(snapshot.read(copy), 3u);
+    EXPECT_EQ(copy.get_pixel(0, 0), graphics::pack(3, 0, 0));
+}
+
+/* test that the presenter publishes presented frames but not skipped ones */
+TEST(frame_snapshot_tests, test_presenter_publishes) {
+    graphics::frame_pipeline pipeline{2, 2};
+    graphics::frame_presenter presenter{pipeline, [](const graphics::framebuffer&) {}};
+    graphics::frame_snapshot snapshot{2, 2};
+    presenter.set_snapshot(&snapshot);
+
+    graphics::framebuffer frame{2, 2};
+    presenter.present(frame);
+    presenter.present(frame);
+    frame.SetPixel(0, 1, 7, 8, 9);
+    presenter.present(frame);
+    EXPECT_EQ(snapshot.published(), 2u);
+
+    graphics::framebuffer copy{2, 2};
+    EXPECT_EQ(snapshot.read(copy), 2u);
+    EXPECT_EQ(copy.get_pixel(0, 1), graphics::pack(7, 8, 9));
+}
+
+/* test that a reader running alongside the publisher only ever sees whole frames */
+TEST(frame_snapshot_tests, test_concurrent_reads_are_consistent) {
+    graphics::frame_snapshot snapshot{16, 16};
+    std::atomic<bool> done{false};
+    std::thread writer([&]() {
+        graphics::framebuffer frame{16, 16};
+        for ( int i = 0; i < 2000; i++ ) {
+            frame.Fill(static_cast<uint8_t>(i), 0, 0);
+            snapshot.publish(frame);
+        }
+        done = true;
+    });
+
+    graphics::framebuffer copy{16, 16};
+    while ( !done ) {
+        snapshot.read(copy);
+        auto first = copy.get_pixel(0, 0);
+        ASSERT_TRUE(std::all_of(copy.data(), copy.data() + copy.size(), [first](auto color) { return color == first; }));
+    }
+    writer.join();
+}
+
+/* test the image encodings */
+TEST(frame_snapshot_tests, test_encodings) {
+    graphics::framebuffer frame{300, 1};
+    frame.SetPixel(299, 0, 1, 2, 3);
+
+    auto ppm = graphics::encode_snapshot(frame, graphics::snapshot_format::ppm);
+    std::string header = "P6\n300 1\n255\n";
+    ASSERT_EQ(ppm.size(), header.size() + 900);
+    EXPECT_TRUE(std::equal(header.begin(), header.end(), ppm.begin()));
+    EXPECT_EQ(ppm.back(), 3);
+
+    // 299 black pixels take two runs, then one run for the last pixel
+    auto rle = graphics::encode_snapshot(frame, graphics::snapshot_format::rle);
+    ASSERT_EQ(rle.size(), 8u + 3 * 4);
+    EXPECT_EQ(rle[4] | (rle[5] << 8), 300);
+    EXPECT_EQ(rle[8], 255);
+    EXPECT_EQ(rle[12], 299 - 256 - 1);
+    EXPECT_EQ(rle[16], 0);
+    EXPECT_EQ(rle[19], 3);
+}
@@ -0,0 +1,112 @@
+/**
+ * \file pixel_remap_tests.cpp
+ * \brief unit tests for the logical to physical pixel remap table
+ * \version 0.1
+ * \date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+
+/********************************** Includes *******************************************/
+#include "gtest/gtest.h"
+#include "frame_pipeline.hpp"
+#include "framebuffer.hpp"
+#include "pixel_remap.hpp"
+
+
+/****************************** Unit Tests ***********************************/
+/* test the default transform is the identity */
+TEST(pixel_remap_tests, test_default_is_identity) {
+    graphics::pixel_remap remap{4, 2, graphics::remap_options{}};
+    ASSERT_TRUE(remap.is_identity());
+    ASSERT_EQ(4, remap.width());
+    ASSERT_EQ(2, remap.height());
+}
+
+/* test serpentine tiling without a panel size falls back to the identity instead of dividing by zero */
+TEST(pixel_remap_tests, test_serpentine_without_panel_size) {
+    graphics::remap_options options;
+    options.tile = graphics::tiling::serpentine;
+    graphics::pixel_remap remap{4, 2, options};
+    ASSERT_TRUE(remap.is_identity());
+    ASSERT_EQ(4, remap.width());
+}
+
+/* test rotating by 90 degrees swaps the logical axes and moves the top-left corner to the top-right */
+TEST(pixel_remap_tests, test_rotate_90) {
+    graphics::remap_options options;
+    options.rotate = graphics::rotation::rotate_90;
+    graphics::pixel_remap remap{4, 2, options};
+    ASSERT_EQ(2, remap.width());
+    ASSERT_EQ(4, remap.height());
+
+    graphics::framebuffer logical{2, 4};
+    graphics::framebuffer physical{4, 2};
+    logical.SetPixel(0, 0, 1, 1, 1);
+    logical.SetPixel(1, 3, 2, 2, 2);
+    remap.apply(logical, physical);
+    ASSERT_EQ(graphics::pack(1, 1, 1), physical.get_pixel(3, 0));
+    ASSERT_EQ(graphics::pack(2, 2, 2), physical.get_pixel(0, 1));
+}
+
+/* test horizontal mirroring */
+TEST(pixel_remap_tests, test_mirror_horizontal) {
+    graphics::remap_options options;
+    options.flip = graphics::mirror::horizontal;
+    graphics::pixel_remap remap{3, 1, options};
+    graphics::framebuffer logical{3, 1};
+    graphics::framebuffer physical{3, 1};
+    logical.SetPixel(0, 0, 9, 9, 9);
+    remap.apply(logical, physical);
+    ASSERT_EQ(graphics::pack(9, 9, 9), physical.get_pixel(2, 0));
+}
+
+/* test a U folded chain of two panels shows a 2x taller canvas */
+TEST(pixel_remap_tests, test_u_chain) {
+    graphics::remap_options options;
+    options.tile = graphics::tiling::u_chain;
+    graphics::pixel_remap remap{8, 2, options};
+    ASSERT_EQ(4, remap.width());
+    ASSERT_EQ(4, remap.height());
+
+    graphics::framebuffer logical{4, 4};
+    graphics::framebuffer physical{8, 2};
+    logical.SetPixel(0, 0, 1, 1, 1);  // top row maps onto the second half of the chain
+    logical.SetPixel(0, 3, 2, 2, 2);  // bottom row is the first half, rotated 180 degrees
+    remap.apply(logical, physical);
+    ASSERT_EQ(graphics::pack(1, 1, 1), physical.get_pixel(4, 0));
+    ASSERT_EQ(graphics::pack(2, 2, 2), physical.get_pixel(3, 0));
+}
+
+/* test a serpentine 2x2 grid of panels */
+TEST(pixel_remap_tests, test_serpentine) {
+    graphics::remap_options options;
+    options.tile = graphics::tiling::serpentine;
+    options.panel_width = 2;
+    options.panel_height = 2;
+    options.panel_columns = 2;
+    graphics::pixel_remap remap{8, 2, options};
+    ASSERT_EQ(4, remap.width());
+    ASSERT_EQ(4, remap.height());
+
+    graphics::framebuffer logical{4, 4};
+    graphics::framebuffer physical{8, 2};
+    logical.SetPixel(3, 1, 1, 1, 1);  // second panel of the first row
+    logical.SetPixel(3, 2, 2, 2, 2);  // right panel of the second row is the third panel, rotated
+    remap.apply(logical, physical);
+    ASSERT_EQ(graphics::pack(1, 1, 1), physical.get_pixel(3, 1));
+    ASSERT_EQ(graphics::pack(2, 2, 2), physical.get_pixel(4, 1));
+}
+
+/* test the pipeline outputs frames in physical order */
+TEST(pixel_remap_tests, test_pipeline_applies_remap) {
+    graphics::remap_options options;
+    options.rotate = graphics::rotation::rotate_180;
+    graphics::frame_pipeline pipeline{graphics::pixel_remap{3, 2, options}};
+    graphics::framebuffer frame{3, 2};
+    frame.SetPixel(0, 0, 5, 5, 5);
+    auto& output = pipeline.process(frame);
+    ASSERT_EQ(graphics::pack(5, 5, 5), output.get_pixel(2, 1));
+}
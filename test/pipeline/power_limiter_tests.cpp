@@ -0,0 +1,84 @@
+/**
+ * \file power_limiter_tests.cpp
+ * \brief unit tests for the channel sum kernel and the power limiting stage
+ * \version 0.1
+ * \date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+
+/********************************** Includes *******************************************/
+#include "gtest/gtest.h"
+#include "framebuffer.hpp"
+#include "kernels.hpp"
+#include "power_limiter.hpp"
+
+
+/****************************** Unit Tests ***********************************/
+/* test that channel sums are exact across the kernel's accumulation blocks */
+TEST(power_limiter_tests, test_channel_sums) {
+    graphics::framebuffer frame{64, 32};
+    frame.Fill(255, 128, 255);
+    auto totals = graphics::kernels::channel_sums(frame);
+    EXPECT_EQ(totals.red, 255u * 64 * 32);
+    EXPECT_EQ(totals.green, 128u * 64 * 32);
+    EXPECT_EQ(totals.blue, 255u * 64 * 32);
+}
+
+/* test the current estimate follows the per LED model and hardware brightness */
+TEST(power_limiter_tests, test_estimate) {
+    graphics::power_settings settings;
+    settings.red_ma = 10;
+    settings.green_ma = 20;
+    settings.blue_ma = 30;
+    settings.idle_ma = 100;
+    settings.hardware_brightness = 50;
+    graphics::power_limiter limiter{settings};
+
+    graphics::framebuffer frame{10, 10};
+    frame.Fill(255, 255, 0);
+    EXPECT_DOUBLE_EQ(limiter.estimate(frame), 100 + 100 * (10 + 20) * 0.5);
+}
+
+/* test that frames within the budget are untouched and frames over it are scaled into it */
+TEST(power_limiter_tests, test_limits_to_budget) {
+    graphics::power_settings settings;
+    settings.budget_ma = 1000;
+    graphics::power_limiter limiter{settings};
+
+    graphics::framebuffer frame{8, 8};
+    frame.Fill(100, 0, 0);
+    limiter.process(frame);
+    EXPECT_EQ(frame.get_pixel(0, 0), graphics::pack(100, 0, 0));
+    EXPECT_EQ(limiter.statistics().limited_frames, 0u);
+
+    // full white is 60mA per pixel, 3840mA for the frame
+    frame.Fill(255, 255, 255);
+    limiter.process(frame);
+    auto statistics = limiter.statistics();
+    EXPECT_EQ(statistics.estimated_ma, 3840u);
+    EXPECT_LE(statistics.limited_ma, 1000u);
+    EXPECT_EQ(statistics.limited_frames, 1u);
+    EXPECT_LE(limiter.estimate(frame), 1000 * 1.01);
+    EXPECT_GT(limiter.estimate(frame), 900);
+}
+
+/* test that an idle current at or over the budget blanks lit frames and leaves dark frames alone */
+TEST(power_limiter_tests, test_idle_over_budget) {
+    graphics::power_settings settings;
+    settings.idle_ma = 500;
+    settings.budget_ma = 400;
+    graphics::power_limiter limiter{settings};
+
+    graphics::framebuffer frame{8, 8};
+    limiter.process(frame);
+    EXPECT_EQ(frame.get_pixel(0, 0), 0u);
+    EXPECT_EQ(limiter.statistics().limited_frames, 0u);
+
+    frame.Fill(255, 255, 255);
+    limiter.process(frame);
+    EXPECT_EQ(frame.get_pixel(0, 0), 0u);
+    EXPECT_EQ(limiter.statistics().limited_frames, 1u);
+}
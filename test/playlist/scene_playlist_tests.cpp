@@ -0,0 +1,204 @@
+/**
+ * \file scene_playlist_tests.cpp
+ * \brief unit tests for the pre-rendering scene playlist
+ * \version 0.1
+ * \date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+/********************************** Includes *******************************************/
+#include "gtest/gtest.h"
+#include "scene_playlist.hpp"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+using namespace std::chrono_literals;
+using namespace graphics;
+
+
+/************************************ Test Fixtures ***************************************/
+// Item that fills the frame with one color
+class solid_item : public playlist_item {
+  public:
+    explicit solid_item(packed_pixel color)
+        : color(color) { }
+
+    void render(framebuffer& frame, std::chrono::steady_clock::time_point) override {
+        for ( std::size_t i = 0; i < frame.size(); i++ ) {
+            frame.data()[i] = color;
+        }
+    }
+
+  private:
+    packed_pixel color;
+};
+
+// Counts builds of an entry and optionally holds them back until released
+struct build_gate {
+    std::atomic<int> builds{0};
+    std::atomic<bool> open{true};
+    std::atomic<bool> off_render_thread{true};
+    std::thread::id render_thread = std::this_thread::get_id();
+
+    std::function<std::unique_ptr<playlist_item>()> make(packed_pixel color) {
+        return [this, color]() {
+            while ( !open ) {
+                std::this_thread::sleep_for(1ms);
+            }
+            off_render_thread = off_render_thread && (std::this_thread::get_id() != render_thread);
+            builds++;
+            return std::make_unique<solid_item>(color);
+        };
+    }
+};
+
+// Wait for a number of builds, then give the preparation thread time to publish the item
+static void wait_for_builds(const build_gate& gate, int count) {
+    for ( int i = 0; (i < 1000) && (gate.builds < count); i++ ) {
+        std::this_thread::sleep_for(1ms);
+    }
+    std::this_thread::sleep_for(20ms);
+}
+
+constexpr packed_pixel red = 0xFF0000;
+constexpr packed_pixel green = 0x00FF00;
+
+
+/****************************** Unit Tests ***********************************/
+/* test that nothing is shown until the first item is built, and that it is built off the render thread */
+TEST(scene_playlist_tests, test_first_item_prepared_off_render_thread) {
+    build_gate gate;
+    gate.open = false;
+    scene_playlist playlist(4, 2);
+    playlist.add(playlist_entry{"clock", 1000ms, gate.make(red)});
+
+    framebuffer frame(4, 2);
+    auto start = scene_playlist::clock::now();
+    playlist.start(start);
+    EXPECT_FALSE(playlist.render(frame, start));
+    EXPECT_EQ(frame.get_pixel(0, 0), 0u);
+
+    gate.open = true;
+    wait_for_builds(gate, 1);
+    EXPECT_TRUE(playlist.render(frame, start + 5ms));
+    EXPECT_EQ(frame.get_pixel(3, 1), red);
+    EXPECT_TRUE(gate.off_render_thread);
+}
+
+/* test that items switch at their start time and the timeline does not drift */
+TEST(scene_playlist_tests, test_switches_on_timeline) {
+    build_gate gate;
+    scene_playlist playlist(4, 2);
+    playlist.add(playlist_entry{"clock", 1000ms, gate.make(red)});
+    playlist.add(playlist_entry{"notices", 1000ms, gate.make(green)});
+
+    framebuffer frame(4, 2);
+    auto start = scene_playlist::clock::now();
+    playlist.start(start);
+    wait_for_builds(gate, 1);
+    ASSERT_TRUE(playlist.render(frame, start));
+    EXPECT_EQ(playlist.next_deadline(start), start + 1000ms);
+
+    // the next item is prepared while the first one is shown
+    wait_for_builds(gate, 2);
+    playlist.render(frame, start + 999ms);
+    EXPECT_EQ(frame.get_pixel(0, 0), red);
+    EXPECT_EQ(playlist.current(), 0u);
+
+    playlist.render(frame, start + 1000ms);
+    EXPECT_EQ(frame.get_pixel(0, 0), green);
+    EXPECT_EQ(playlist.current(), 1u);
+
+    // a switch a few milliseconds into its frame keeps the playlist's timeline, and the list wraps around
+    wait_for_builds(gate, 3);
+    playlist.render(frame, start + 2005ms);
+    EXPECT_EQ(frame.get_pixel(0, 0), red);
+    EXPECT_EQ(playlist.current(), 0u);
+    EXPECT_EQ(playlist.next_deadline(start + 2005ms), start + 3000ms);
+
+    auto stats = playlist.statistics();
+    EXPECT_EQ(stats.switches, 3u);
+    EXPECT_EQ(stats.late, 0u);
+    EXPECT_TRUE(gate.off_render_thread);
+}
+
+/* test that the outgoing item blends into the incoming one */
+TEST(scene_playlist_tests, test_crossfade) {
+    build_gate gate;
+    scene_playlist playlist(4, 2, 100ms);
+    playlist.add(playlist_entry{"clock", 1000ms, gate.make(red)});
+    playlist.add(playlist_entry{"notices", 1000ms, gate.make(green)});
+
+    framebuffer frame(4, 2);
+    auto start = scene_playlist::clock::now();
+    playlist.start(start);
+    wait_for_builds(gate, 1);
+    playlist.render(frame, start);
+    wait_for_builds(gate, 2);
+
+    playlist.render(frame, start + 1000ms);
+    EXPECT_EQ(frame.get_pixel(0, 0), red);
+    EXPECT_EQ(playlist.next_deadline(start + 1000ms), start + 1000ms);
+
+    playlist.render(frame, start + 1050ms);
+    auto pixel = frame.get_pixel(0, 0);
+    EXPECT_NEAR(static_cast<int>((pixel >> 16) & 0xFF), 128, 2);
+    EXPECT_NEAR(static_cast<int>((pixel >> 8) & 0xFF), 127, 2);
+
+    playlist.render(frame, start + 1100ms);
+    EXPECT_EQ(frame.get_pixel(0, 0), green);
+    EXPECT_EQ(playlist.next_deadline(start + 1100ms), start + 2000ms);
+    EXPECT_EQ(playlist.statistics().crossfade_frames, 2u);
+}
+
+/* test that an item that is not ready keeps the current one on screen and is counted late */
+TEST(scene_playlist_tests, test_late_item) {
+    build_gate gate;
+    scene_playlist playlist(4, 2);
+    playlist.add(playlist_entry{"clock", 1000ms, gate.make(red)});
+    playlist.add(playlist_entry{"stats", 1000ms, gate.make(green)});
+
+    framebuffer frame(4, 2);
+    auto start = scene_playlist::clock::now();
+    playlist.start(start);
+    wait_for_builds(gate, 1);
+    gate.open = false;
+    playlist.render(frame, start);
+
+    playlist.render(frame, start + 1000ms);
+    EXPECT_EQ(frame.get_pixel(0, 0), red);
+    EXPECT_EQ(playlist.next_deadline(start + 1010ms), start + 1010ms + scene_playlist::ready_poll);
+
+    gate.open = true;
+    wait_for_builds(gate, 2);
+    playlist.render(frame, start + 1200ms);
+    EXPECT_EQ(frame.get_pixel(0, 0), green);
+    EXPECT_EQ(playlist.next_deadline(start + 1200ms), start + 2200ms);
+    EXPECT_EQ(playlist.statistics().late, 1u);
+}
+
+/* test that entries that fail to build are skipped and a ready item wakes the render loop */
+TEST(scene_playlist_tests, test_failed_build_is_skipped) {
+    build_gate gate;
+    std::atomic<int> wakes{0};
+    scene_playlist playlist(4, 2);
+    playlist.add(playlist_entry{"broken", 1000ms, []() { return std::unique_ptr<playlist_item>{}; }});
+    playlist.add(playlist_entry{"notices", 1000ms, gate.make(green)});
+    playlist.set_ready_handler([&]() { wakes++; });
+
+    framebuffer frame(4, 2);
+    auto start = scene_playlist::clock::now();
+    playlist.start(start);
+    EXPECT_EQ(playlist.next_deadline(start), start + scene_playlist::ready_poll);
+    wait_for_builds(gate, 1);
+    EXPECT_GE(wakes, 1);
+    EXPECT_TRUE(playlist.render(frame, start + 5ms));
+    EXPECT_EQ(frame.get_pixel(0, 0), green);
+    EXPECT_EQ(playlist.current(), 1u);
+    EXPECT_GE(playlist.statistics().failed_builds, 1u);
+}
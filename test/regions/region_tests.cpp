@@ -0,0 +1,106 @@
+/**
+ * \file region_tests.cpp
+ * \brief unit tests for the region partitioned display
+ * \version 0.1
+ * \date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+
+/********************************** Includes *******************************************/
+#include "gtest/gtest.h"
+#include "canvas.hpp"
+#include "framebuffer.hpp"
+#include "rect.hpp"
+#include "region_display.hpp"
+#include <thread>
+
+
+/****************************** Unit Tests ***********************************/
+/* test rectangle intersection and union */
+TEST(region_tests, test_rect_operations) {
+    graphics::rect a{0, 0, 4, 4};
+    graphics::rect b{2, 2, 4, 4};
+    EXPECT_EQ(graphics::intersect(a, b), (graphics::rect{2, 2, 2, 2}));
+    EXPECT_EQ(graphics::unite(a, b), (graphics::rect{0, 0, 6, 6}));
+    EXPECT_FALSE(graphics::overlaps(a, graphics::rect{4, 0, 2, 2}));
+    EXPECT_TRUE(graphics::contains(b, 5, 5));
+    EXPECT_FALSE(graphics::contains(b, 6, 5));
+}
+
+/* test that invalid regions are rejected */
+TEST(region_tests, test_add_region_validation) {
+    graphics::region_display display{8, 4};
+    EXPECT_TRUE(display.add_region("left", graphics::rect{0, 0, 4, 4}));
+    EXPECT_FALSE(display.add_region("left", graphics::rect{4, 0, 4, 4}));
+    EXPECT_FALSE(display.add_region("overlap", graphics::rect{3, 0, 2, 2}));
+    EXPECT_FALSE(display.add_region("outside", graphics::rect{6, 0, 4, 4}));
+    EXPECT_FALSE(display.add_region("empty", graphics::rect{4, 0, 0, 4}));
+    EXPECT_TRUE(display.add_region("right", graphics::rect{4, 0, 4, 4}));
+    EXPECT_NE(display.find("right"), nullptr);
+    EXPECT_EQ(display.find("missing"), nullptr);
+}
+
+/* test that clearing a region leaves the rest of the frame alone and only dirty regions are composed */
+TEST(region_tests, test_compose_dirty_regions_only) {
+    graphics::region_display display{8, 4};
+    auto left = display.add_region("left", graphics::rect{0, 0, 4, 4}).get_value();
+    auto right = display.add_region("right", graphics::rect{4, 0, 4, 4}).get_value();
+    graphics::framebuffer frame{8, 4};
+
+    left->fill(graphics::pixel{255, 0, 0});
+    right->fill(graphics::pixel{0, 255, 0});
+    EXPECT_EQ(display.compose(frame), 2);
+    EXPECT_EQ(display.compose(frame), 0);
+
+    right->draw([](graphics::canvas& canvas) {
+        canvas.clear();
+        canvas.set_pixel(0, 0, graphics::pixel{0, 0, 255});
+    });
+    EXPECT_FALSE(left->is_dirty());
+    EXPECT_EQ(display.compose(frame), 1);
+    EXPECT_EQ(frame.get_pixel(3, 3), graphics::pack(255, 0, 0));
+    EXPECT_EQ(frame.get_pixel(4, 0), graphics::pack(0, 0, 255));
+    EXPECT_EQ(frame.get_pixel(5, 0), 0u);
+}
+
+/* test that regions clip drawing to their bounds */
+TEST(region_tests, test_region_clips_drawing) {
+    graphics::region_display display{8, 4};
+    auto middle = display.add_region("middle", graphics::rect{2, 1, 2, 2}).get_value();
+    graphics::framebuffer frame{8, 4};
+
+    middle->draw([](graphics::canvas& canvas) { canvas.fill_span(-4, 1, 16, graphics::pixel{9, 9, 9}); });
+    display.compose(frame);
+    EXPECT_EQ(frame.get_pixel(2, 2), graphics::pack(9, 9, 9));
+    EXPECT_EQ(frame.get_pixel(3, 2), graphics::pack(9, 9, 9));
+    EXPECT_EQ(frame.get_pixel(1, 2), 0u);
+    EXPECT_EQ(frame.get_pixel(4, 2), 0u);
+}
+
+/* test that separate threads can draw into their own regions while frames are composed */
+TEST(region_tests, test_concurrent_updates) {
+    graphics::region_display display{8, 4};
+    auto left = display.add_region("left", graphics::rect{0, 0, 4, 4}).get_value();
+    auto right = display.add_region("right", graphics::rect{4, 0, 4, 4}).get_value();
+    graphics::framebuffer frame{8, 4};
+
+    auto painter = [](graphics::region* target, uint8_t value) {
+        for ( int i = 0; i < 1000; i++ ) {
+            target->fill(graphics::pixel{value, value, value});
+        }
+    };
+    std::thread first(painter, left, 1);
+    std::thread second(painter, right, 2);
+    for ( int i = 0; i < 100; i++ ) {
+        display.compose(frame);
+    }
+    first.join();
+    second.join();
+    display.compose(frame);
+
+    EXPECT_EQ(frame.get_pixel(0, 0), graphics::pack(1, 1, 1));
+    EXPECT_EQ(frame.get_pixel(7, 3), graphics::pack(2, 2, 2));
+}
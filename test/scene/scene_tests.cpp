@@ -0,0 +1,166 @@
+/**
+ * \file scene_tests.cpp
+ * \brief unit tests for the retained scene graph and its damage tracking
+ * \version 0.1
+ * \date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+
+/********************************** Includes *******************************************/
+#include "gtest/gtest.h"
+#include "canvas.hpp"
+#include "framebuffer.hpp"
+#include "rectangle.hpp"
+#include "scene.hpp"
+#include <memory>
+
+/******************************** Local Functions **************************************/
+static constexpr graphics::pixel red{255, 0, 0};
+static constexpr graphics::pixel blue{0, 0, 255};
+
+/* create a node drawing a filled rectangle at its own origin */
+static std::unique_ptr<graphics::scene_node> make_box(int x, int y, int width, int height, const graphics::pixel& color) {
+    auto box = std::make_shared<graphics::rectangle>(graphics::origin{0, 0}, width, height, color, true);
+    return std::make_unique<graphics::scene_node>(box, x, y);
+}
+
+
+/****************************** Unit Tests ***********************************/
+/* test that span shapes report the area their spans cover */
+TEST(scene_tests, test_span_shape_bounds) {
+    graphics::rectangle box{graphics::origin{3, 2}, 4, 5, red, true};
+    EXPECT_EQ(box.bounds(), (graphics::rect{3, 2, 4, 5}));
+}
+
+/* test that the first render draws everything and an unchanged scene draws nothing */
+TEST(scene_tests, test_first_render_then_idle) {
+    graphics::framebuffer frame{16, 8};
+    graphics::canvas canvas{&frame};
+    graphics::scene scene;
+    auto group = scene.root().add_child(std::make_unique<graphics::scene_node>(nullptr, 4, 2));
+    group->add_child(make_box(1, 1, 2, 2, red));
+
+    EXPECT_EQ(scene.render(canvas), 1);
+    EXPECT_EQ(scene.damage()[0], (graphics::rect{0, 0, 16, 8}));
+    EXPECT_EQ(frame.get_pixel(5, 3), graphics::pack(red));
+    EXPECT_EQ(frame.get_pixel(6, 4), graphics::pack(red));
+    EXPECT_EQ(frame.get_pixel(7, 4), 0u);
+
+    EXPECT_FALSE(scene.root().is_dirty());
+    EXPECT_EQ(scene.render(canvas), 0);
+    EXPECT_EQ(scene.stats().nodes_drawn, 1u);
+}
+
+/* test that moving a group damages the old and new areas and leaves other nodes alone */
+TEST(scene_tests, test_move_only_redraws_damage) {
+    graphics::framebuffer frame{32, 8};
+    graphics::canvas canvas{&frame};
+    graphics::scene scene;
+    auto group = scene.root().add_child(std::make_unique<graphics::scene_node>(nullptr, 0, 0));
+    group->add_child(make_box(0, 0, 2, 2, red));
+    scene.root().add_child(make_box(24, 4, 4, 4, blue));
+    scene.render(canvas);
+    auto drawn = scene.stats().nodes_drawn;
+
+    group->set_position(3, 0);
+    EXPECT_TRUE(scene.root().is_dirty());
+    EXPECT_EQ(scene.render(canvas), 2);
+    EXPECT_EQ(scene.stats().nodes_drawn, drawn + 1);
+
+    // the old position is cleared, the new one drawn and the far box untouched
+    EXPECT_EQ(frame.get_pixel(0, 0), 0u);
+    EXPECT_EQ(frame.get_pixel(3, 0), graphics::pack(red));
+    EXPECT_EQ(frame.get_pixel(4, 1), graphics::pack(red));
+    EXPECT_EQ(frame.get_pixel(25, 5), graphics::pack(blue));
+}
+
+/* test that nodes overlapping a damaged area are redrawn in order so stacking is kept */
+TEST(scene_tests, test_overlapping_nodes_redraw_in_order) {
+    graphics::framebuffer frame{16, 8};
+    graphics::canvas canvas{&frame};
+    graphics::scene scene;
+    auto under = scene.root().add_child(make_box(0, 0, 4, 4, red));
+    scene.root().add_child(make_box(2, 2, 4, 4, blue));
+    scene.render(canvas);
+
+    under->invalidate();
+    EXPECT_EQ(scene.render(canvas), 1);
+    EXPECT_EQ(scene.damage()[0], (graphics::rect{0, 0, 4, 4}));
+    EXPECT_EQ(frame.get_pixel(1, 1), graphics::pack(red));
+    EXPECT_EQ(frame.get_pixel(3, 3), graphics::pack(blue));
+}
+
+/* test that hiding and removing nodes clears the area they covered */
+TEST(scene_tests, test_hide_and_remove) {
+    graphics::framebuffer frame{16, 8};
+    graphics::canvas canvas{&frame};
+    graphics::scene scene;
+    auto first = scene.root().add_child(make_box(0, 0, 2, 2, red));
+    auto second = scene.root().add_child(make_box(8, 0, 2, 2, blue));
+    scene.render(canvas);
+
+    first->set_visible(false);
+    scene.render(canvas);
+    EXPECT_EQ(frame.get_pixel(0, 0), 0u);
+    EXPECT_EQ(frame.get_pixel(8, 0), graphics::pack(blue));
+
+    first->set_visible(true);
+    scene.render(canvas);
+    EXPECT_EQ(frame.get_pixel(0, 0), graphics::pack(red));
+
+    EXPECT_TRUE(scene.root().remove_child(second));
+    EXPECT_EQ(scene.render(canvas), 1);
+    EXPECT_EQ(scene.damage()[0], (graphics::rect{8, 0, 2, 2}));
+    EXPECT_EQ(frame.get_pixel(8, 0), 0u);
+}
+
+/* test that a shape without bounds placed at an offset is still drawn, instead of its bounds wrapping */
+TEST(scene_tests, test_unbounded_shape_at_offset) {
+    struct dot : graphics::shape {
+        dot()
+            : graphics::shape(graphics::origin{0, 0}) { }
+        void draw(graphics::canvas& canvas) override {
+            canvas.fill_span(0, 0, 1, red);
+        }
+    };
+
+    EXPECT_EQ(graphics::translate(graphics::rect{0, 0, UINT16_MAX, UINT16_MAX}, 5, 3), (graphics::rect{5, 3, UINT16_MAX, UINT16_MAX}));
+    EXPECT_EQ(graphics::unite(graphics::rect{-10, 0, UINT16_MAX, 1}, graphics::rect{0, 0, 1, 1}).width, UINT16_MAX);
+
+    graphics::framebuffer frame{16, 8};
+    graphics::canvas canvas{&frame};
+    graphics::scene scene;
+    auto group = scene.root().add_child(std::make_unique<graphics::scene_node>(nullptr, 4, 2));
+    group->add_child(make_box(0, 0, 1, 1, blue));
+    group->add_child(std::make_unique<graphics::scene_node>(std::make_shared<dot>(), 1, 1));
+    scene.render(canvas);
+    EXPECT_EQ(frame.get_pixel(5, 3), graphics::pack(red));
+
+    // redraws damaged by another node still reach the unbounded shape through its group's merged bounds
+    scene.root().add_child(make_box(5, 3, 1, 1, blue));
+    scene.render(canvas);
+    frame.Clear();
+    scene.invalidate_all();
+    scene.render(canvas);
+    EXPECT_EQ(frame.get_pixel(5, 3), graphics::pack(blue));
+    EXPECT_EQ(frame.get_pixel(4, 2), graphics::pack(blue));
+}
+
+/* test that a shape changed through its own setters is redrawn without invalidating its node */
+TEST(scene_tests, test_shape_revision_redraws) {
+    graphics::framebuffer frame{16, 8};
+    graphics::canvas canvas{&frame};
+    graphics::scene scene;
+    auto box = std::make_shared<graphics::rectangle>(graphics::origin{0, 0}, 2, 2, red, true);
+    scene.root().add_child(std::make_unique<graphics::scene_node>(box, 0, 0));
+    scene.render(canvas);
+    EXPECT_EQ(scene.render(canvas), 0);
+
+    box->set_origin(graphics::origin{4, 4});
+    EXPECT_GT(scene.render(canvas), 0);
+    EXPECT_EQ(frame.get_pixel(0, 0), 0u);
+    EXPECT_EQ(frame.get_pixel(5, 5), graphics::pack(red));
+}
@@ -0,0 +1,151 @@
+/**
+ * \file shapes_tests.cpp
+ * \brief unit tests for the span rasterized geometry primitives
+ * \version 0.1
+ * \date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+
+/********************************** Includes *******************************************/
+#include "gtest/gtest.h"
+#include "canvas.hpp"
+#include "circle.hpp"
+#include "framebuffer.hpp"
+#include "line.hpp"
+#include "polygon.hpp"
+#include "rectangle.hpp"
+#include <vector>
+
+/******************************** Local Functions **************************************/
+/* count the lit pixels of a frame */
+static int count_pixels(const graphics::framebuffer& frame) {
+    int count = 0;
+    for ( std::size_t i = 0; i < frame.size(); i++ ) {
+        count += (frame.data()[i] != 0) ? 1 : 0;
+    }
+    return count;
+}
+
+static constexpr graphics::pixel white{255, 255, 255};
+
+
+/****************************** Unit Tests ***********************************/
+/* test a horizontal line is a single span */
+TEST(shapes_tests, test_horizontal_line_is_one_span) {
+    graphics::line line{graphics::origin{0, 0}, graphics::point{0, 3}, graphics::point{9, 3}, white};
+    ASSERT_EQ(1u, line.spans().size());
+    ASSERT_EQ(10, line.spans()[0].length);
+}
+
+/* test a shallow line merges runs on each row */
+TEST(shapes_tests, test_shallow_line_spans) {
+    graphics::line line{graphics::origin{0, 0}, graphics::point{0, 0}, graphics::point{7, 1}, white};
+    graphics::framebuffer frame{8, 2};
+    graphics::canvas canvas{&frame};
+    line.draw(canvas);
+    ASSERT_EQ(2u, line.spans().size());
+    ASSERT_EQ(8, count_pixels(frame));
+    ASSERT_NE(0u, frame.get_pixel(0, 0));
+    ASSERT_NE(0u, frame.get_pixel(7, 1));
+}
+
+/* test a steep line going backwards reaches both end points */
+TEST(shapes_tests, test_steep_reverse_line) {
+    graphics::line line{graphics::origin{0, 0}, graphics::point{3, 9}, graphics::point{0, 0}, white};
+    graphics::framebuffer frame{4, 10};
+    graphics::canvas canvas{&frame};
+    line.draw(canvas);
+    ASSERT_EQ(10, count_pixels(frame));
+    ASSERT_NE(0u, frame.get_pixel(3, 9));
+    ASSERT_NE(0u, frame.get_pixel(0, 0));
+}
+
+/* test outline and filled rectangles */
+TEST(shapes_tests, test_rectangle) {
+    graphics::framebuffer frame{10, 10};
+    graphics::canvas canvas{&frame};
+    graphics::rectangle outline{graphics::origin{1, 1}, 4, 3, white};
+    outline.draw(canvas);
+    ASSERT_EQ(10, count_pixels(frame));
+
+    frame.Clear();
+    graphics::rectangle filled{graphics::origin{1, 1}, 4, 3, white, true};
+    filled.draw(canvas);
+    ASSERT_EQ(12, count_pixels(frame));
+    ASSERT_EQ(3u, filled.spans().size());
+}
+
+/* test the filled circle is symmetric and the outline is a subset of it */
+TEST(shapes_tests, test_circle) {
+    graphics::framebuffer filled_frame{21, 21};
+    graphics::framebuffer outline_frame{21, 21};
+    graphics::canvas filled_canvas{&filled_frame};
+    graphics::canvas outline_canvas{&outline_frame};
+    graphics::circle{graphics::origin{10, 10}, 8, white, true}.draw(filled_canvas);
+    graphics::circle{graphics::origin{10, 10}, 8, white}.draw(outline_canvas);
+
+    ASSERT_NE(0u, filled_frame.get_pixel(10, 2));
+    ASSERT_NE(0u, filled_frame.get_pixel(2, 10));
+    ASSERT_EQ(0u, filled_frame.get_pixel(10, 1));
+    ASSERT_EQ(0u, outline_frame.get_pixel(10, 10));
+    for ( int y = 0; y < 21; y++ ) {
+        for ( int x = 0; x < 21; x++ ) {
+            ASSERT_EQ(filled_frame.get_pixel(x, y), filled_frame.get_pixel(20 - x, 20 - y));
+            if ( outline_frame.get_pixel(x, y) != 0 ) {
+                ASSERT_NE(0u, filled_frame.get_pixel(x, y));
+            }
+        }
+    }
+}
+
+/* test a quarter arc only covers its quadrant */
+TEST(shapes_tests, test_arc_quadrant) {
+    graphics::framebuffer frame{21, 21};
+    graphics::canvas canvas{&frame};
+    graphics::arc{graphics::origin{10, 10}, 8, 0, 90, white}.draw(canvas);
+    ASSERT_NE(0u, frame.get_pixel(18, 10));
+    ASSERT_NE(0u, frame.get_pixel(10, 18));
+    ASSERT_EQ(0u, frame.get_pixel(2, 10));
+    ASSERT_EQ(0u, frame.get_pixel(10, 2));
+}
+
+/* test the rounded rectangle trims its corners */
+TEST(shapes_tests, test_rounded_rectangle) {
+    graphics::framebuffer frame{10, 8};
+    graphics::canvas canvas{&frame};
+    graphics::rounded_rectangle{graphics::origin{0, 0}, 10, 8, 3, white, true}.draw(canvas);
+    ASSERT_EQ(0u, frame.get_pixel(0, 0));
+    ASSERT_EQ(0u, frame.get_pixel(9, 7));
+    ASSERT_NE(0u, frame.get_pixel(0, 4));
+    ASSERT_NE(0u, frame.get_pixel(5, 0));
+}
+
+/* test polygon fill covers pixel centres exactly */
+TEST(shapes_tests, test_polygon_square_and_triangle) {
+    graphics::framebuffer frame{10, 10};
+    graphics::canvas canvas{&frame};
+    graphics::polygon square{graphics::origin{0, 0}, {{2, 2}, {6, 2}, {6, 6}, {2, 6}}, white};
+    square.draw(canvas);
+    ASSERT_EQ(16, count_pixels(frame));
+    ASSERT_EQ(4u, square.spans().size());
+
+    frame.Clear();
+    graphics::polygon triangle{graphics::origin{0, 0}, {{0, 0}, {8, 0}, {0, 8}}, white};
+    triangle.draw(canvas);
+    ASSERT_EQ(28, count_pixels(frame));
+}
+
+/* test moving a shape does not re-rasterize it and clips at the canvas edge */
+TEST(shapes_tests, test_move_and_clip) {
+    graphics::framebuffer frame{4, 4};
+    graphics::canvas canvas{&frame};
+    graphics::rectangle rectangle{graphics::origin{0, 0}, 3, 3, white, true};
+    auto spans = rectangle.spans().size();
+    rectangle.set_origin(graphics::origin{2, 2});
+    rectangle.draw(canvas);
+    ASSERT_EQ(spans, rectangle.spans().size());
+    ASSERT_EQ(4, count_pixels(frame));
+}
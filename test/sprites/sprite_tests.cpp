@@ -0,0 +1,137 @@
+/**
+ * \file sprite_tests.cpp
+ * \brief unit tests for memory mapped sprite sheets and the sprite shape
+ * \version 0.1
+ * \date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+
+/********************************** Includes *******************************************/
+#include "gtest/gtest.h"
+#include "canvas.hpp"
+#include "framebuffer.hpp"
+#include "sprite.hpp"
+#include "sprite_sheet.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/************************************ Test Fixtures ***************************************/
+// Writes test sheets into a temporary directory that is removed after each test
+class sprite_tests : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        auto pattern = (std::filesystem::temp_directory_path() / "sprite_tests_XXXXXX").string();
+        ASSERT_NE(mkdtemp(pattern.data()), nullptr);
+        directory = pattern;
+    }
+
+    void TearDown() override {
+        std::error_code error;
+        std::filesystem::remove_all(directory, error);
+    }
+
+    // Get the path of a file in the test directory
+    std::string path_of(const std::string& name) const {
+        return (directory / name).string();
+    }
+
+    // Write a sheet with a 2x2 two frame sprite "arrow" and a masked 3x1 sprite "dots"
+    std::string write_test_sheet(const char* first_name = "arrow", uint16_t first_frames = 2) const;
+
+    std::filesystem::path directory;
+};
+
+std::string sprite_tests::write_test_sheet(const char* first_name, uint16_t first_frames) const {
+    auto path = path_of("test_sheet.sprites");
+    std::vector<uint8_t> data(sizeof(graphics::sprite_sheet_header) + 2 * sizeof(graphics::sprite_entry));
+
+    graphics::sprite_sheet_header header{graphics::sprite_sheet_magic, graphics::sprite_sheet_version, 0, 2, 0};
+    std::memcpy(data.data(), &header, sizeof(header));
+
+    auto append = [&](const void* source, std::size_t length) {
+        auto offset = static_cast<uint32_t>(data.size());
+        data.resize(data.size() + length);
+        std::memcpy(data.data() + offset, source, length);
+        data.resize((data.size() + 3) / 4 * 4);
+        return offset;
+    };
+
+    std::vector<graphics::packed_pixel> arrow = {1, 2, 3, 4, 5, 6, 7, 8};
+    std::vector<graphics::packed_pixel> dots = {9, 10, 11};
+    uint8_t dots_mask = 0xA0;
+
+    graphics::sprite_entry arrow_entry{"", 2, 2, first_frames, 0, append(arrow.data(), arrow.size() * 4), 0};
+    std::strncpy(arrow_entry.name, first_name, sizeof(arrow_entry.name));
+    graphics::sprite_entry dots_entry{"dots", 3, 1, 1, 0, append(dots.data(), dots.size() * 4), 0};
+    dots_entry.mask_offset = append(&dots_mask, 1);
+    std::memcpy(data.data() + sizeof(header), &arrow_entry, sizeof(arrow_entry));
+    std::memcpy(data.data() + sizeof(header) + sizeof(arrow_entry), &dots_entry, sizeof(dots_entry));
+
+    std::ofstream file{path, std::ios::binary};
+    file.write(reinterpret_cast<const char*>(data.data()), data.size());
+    return path;
+}
+
+
+/****************************** Unit Tests ***********************************/
+/* test loading a sheet and looking up sprites by name */
+TEST_F(sprite_tests, test_load_and_find) {
+    auto sheet = graphics::sprite_sheet::load_from_path(write_test_sheet());
+    ASSERT_TRUE(sheet);
+    ASSERT_EQ(2u, sheet.get_value().size());
+
+    auto arrow = sheet.get_value().find("arrow");
+    ASSERT_TRUE(arrow);
+    ASSERT_EQ(2, arrow->frame_count);
+    ASSERT_EQ(5u, arrow->frame_pixels(1)[0]);
+    ASSERT_FALSE(sheet.get_value().find("missing"));
+}
+
+/* test loading a missing or invalid file fails */
+TEST_F(sprite_tests, test_invalid_sheet_fails) {
+    ASSERT_FALSE(graphics::sprite_sheet::load_from_path(path_of("does_not_exist.sprites")));
+    std::ofstream{path_of("bad.sprites")} << "this is not a sprite sheet";
+    ASSERT_FALSE(graphics::sprite_sheet::load_from_path(path_of("bad.sprites")));
+}
+
+/* test sheets that would break lookups or drawing are rejected */
+TEST_F(sprite_tests, test_unsorted_or_empty_sprites_fail) {
+    ASSERT_FALSE(graphics::sprite_sheet::load_from_path(write_test_sheet("zebra")));
+    ASSERT_FALSE(graphics::sprite_sheet::load_from_path(write_test_sheet("dots")));
+    ASSERT_FALSE(graphics::sprite_sheet::load_from_path(write_test_sheet("arrow", 0)));
+}
+
+/* test drawing frames and masks */
+TEST_F(sprite_tests, test_draw_frames_and_mask) {
+    auto sheet = graphics::sprite_sheet::load_from_path(write_test_sheet());
+    graphics::framebuffer frame{4, 4};
+    graphics::canvas canvas{&frame};
+
+    graphics::sprite arrow{graphics::origin{1, 1}, sheet.get_value().find("arrow").value()};
+    arrow.next_frame();
+    arrow.draw(canvas);
+    ASSERT_EQ(5u, frame.get_pixel(1, 1));
+    ASSERT_EQ(8u, frame.get_pixel(2, 2));
+
+    // negative frames wrap backwards from the last frame
+    arrow.set_frame(-1);
+    arrow.draw(canvas);
+    ASSERT_EQ(5u, frame.get_pixel(1, 1));
+    arrow.set_frame(-2);
+    arrow.draw(canvas);
+    ASSERT_EQ(1u, frame.get_pixel(1, 1));
+
+    frame.Clear();
+    graphics::sprite dots{graphics::origin{0, 0}, sheet.get_value().find("dots").value()};
+    dots.draw(canvas);
+    ASSERT_EQ(9u, frame.get_pixel(0, 0));
+    ASSERT_EQ(0u, frame.get_pixel(1, 0));
+    ASSERT_EQ(11u, frame.get_pixel(2, 0));
+}
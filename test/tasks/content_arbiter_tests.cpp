@@ -0,0 +1,141 @@
+/**
+ * \file content_arbiter_tests.cpp
+ * \brief unit tests for priority preemption of content tasks
+ * \version 0.1
+ * \date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+/********************************** Includes *******************************************/
+#include "gtest/gtest.h"
+#include "content_arbiter.hpp"
+#include <chrono>
+#include <memory>
+
+using namespace std::chrono_literals;
+
+
+/************************************ Test Fixtures ***************************************/
+// Task that fills the canvas with its color and finishes after a number of frames
+class counting_task : public tasks::content_task {
+  public:
+    counting_task(graphics::pixel color, int frames)
+        : color(color)
+        , frames(frames) { }
+
+    std::optional<time_point> draw(graphics::canvas& canvas, time_point now) override {
+        if ( drawn == frames ) {
+            return {};
+        }
+        drawn++;
+        canvas.fill(color.red, color.green, color.blue);
+        return now + 10ms;
+    }
+
+    void on_preempted(time_point) override {
+        preempted++;
+    }
+
+    void on_resumed(time_point) override {
+        resumed++;
+    }
+
+    graphics::pixel color;
+    int frames;
+    int drawn = 0;
+    int preempted = 0;
+    int resumed = 0;
+};
+
+
+/****************************** Unit Tests ***********************************/
+/* test that a more urgent task takes over at the next frame and the preempted task resumes where it left off */
+TEST(content_arbiter_tests, test_preempt_and_resume) {
+    graphics::framebuffer frame(4, 2);
+    graphics::canvas canvas(&frame);
+    tasks::content_arbiter arbiter;
+    auto now = tasks::content_arbiter::clock::now();
+
+    auto background = std::make_shared<counting_task>(graphics::pixel{0, 0, 255}, 5);
+    auto alert = std::make_shared<counting_task>(graphics::pixel{255, 0, 0}, 2);
+    arbiter.submit(background, 0, now);
+    EXPECT_TRUE(arbiter.draw(canvas, now));
+    EXPECT_TRUE(arbiter.draw(canvas, now + 10ms));
+    EXPECT_EQ(background->drawn, 2);
+
+    arbiter.submit(alert, 10, now + 15ms);
+    EXPECT_TRUE(arbiter.draw(canvas, now + 20ms));
+    EXPECT_EQ(frame.get_pixel(0, 0), graphics::pack(255, 0, 0));
+    EXPECT_EQ(background->preempted, 1);
+    EXPECT_EQ(arbiter.next_deadline(), now + 30ms);
+
+    // the alert finishes and the background task continues from its third frame in the same frame
+    arbiter.draw(canvas, now + 30ms);
+    arbiter.draw(canvas, now + 40ms);
+    EXPECT_EQ(frame.get_pixel(0, 0), graphics::pack(0, 0, 255));
+    EXPECT_EQ(background->resumed, 1);
+    EXPECT_EQ(background->drawn, 3);
+    EXPECT_EQ(alert->drawn, 2);
+
+    auto stats = arbiter.stats();
+    EXPECT_EQ(stats.preemptions, 1u);
+    EXPECT_EQ(stats.resumptions, 1u);
+    EXPECT_EQ(stats.completed, 1u);
+}
+
+/* test that equal priorities run in submission order and lower priorities wait */
+TEST(content_arbiter_tests, test_priority_order) {
+    graphics::framebuffer frame(4, 2);
+    graphics::canvas canvas(&frame);
+    tasks::content_arbiter arbiter;
+    auto now = tasks::content_arbiter::clock::now();
+
+    auto first = std::make_shared<counting_task>(graphics::pixel{255, 0, 0}, 1);
+    auto second = std::make_shared<counting_task>(graphics::pixel{0, 255, 0}, 1);
+    auto low = std::make_shared<counting_task>(graphics::pixel{0, 0, 255}, 1);
+    arbiter.submit(low, 1, now);
+    arbiter.submit(first, 5, now);
+    arbiter.submit(second, 5, now);
+
+    arbiter.draw(canvas, now);
+    EXPECT_EQ(frame.get_pixel(0, 0), graphics::pack(255, 0, 0));
+    arbiter.draw(canvas, now + 10ms);
+    EXPECT_EQ(frame.get_pixel(0, 0), graphics::pack(0, 255, 0));
+    arbiter.draw(canvas, now + 20ms);
+    EXPECT_EQ(frame.get_pixel(0, 0), graphics::pack(0, 0, 255));
+    EXPECT_FALSE(arbiter.draw(canvas, now + 30ms));
+    EXPECT_FALSE(arbiter.is_active());
+    EXPECT_FALSE(arbiter.next_deadline());
+    EXPECT_EQ(low->preempted, 0);
+}
+
+/* test that submitting wakes the render loop and latency runs from submission to presentation */
+TEST(content_arbiter_tests, test_latency_measurement) {
+    graphics::framebuffer frame(4, 2);
+    graphics::canvas canvas(&frame);
+    tasks::content_arbiter arbiter{5ms};
+    int wakes = 0;
+    arbiter.set_wake_handler([&]() { wakes++; });
+    auto now = tasks::content_arbiter::clock::now();
+
+    auto id = arbiter.submit(std::make_shared<counting_task>(graphics::pixel{255, 0, 0}, 100), 1, now);
+    arbiter.submit(std::make_shared<counting_task>(graphics::pixel{0, 255, 0}, 100), 0, now);
+    EXPECT_EQ(wakes, 2);
+
+    arbiter.draw(canvas, now + 1ms);
+    arbiter.presented(now + 3ms);
+    arbiter.remove(id);
+    arbiter.draw(canvas, now + 10ms);
+    arbiter.presented(now + 12ms);
+    arbiter.presented(now + 30ms);
+
+    auto stats = arbiter.stats();
+    EXPECT_EQ(stats.latency_count, 2u);
+    EXPECT_EQ(stats.max_latency, 12ms);
+    EXPECT_EQ(stats.total_latency, 15ms);
+    EXPECT_EQ(stats.over_budget, 1u);
+    EXPECT_EQ(stats.completed, 1u);
+}
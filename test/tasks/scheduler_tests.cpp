@@ -0,0 +1,104 @@
+/**
+ * \file scheduler_tests.cpp
+ * \brief unit tests for the timer wheel and the deadline driven frame scheduler
+ * \version 0.1
+ * \date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+
+/********************************** Includes *******************************************/
+#include "gtest/gtest.h"
+#include "frame_scheduler.hpp"
+#include "timer_wheel.hpp"
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+
+/****************************** Unit Tests ***********************************/
+/* test that timers expire in deadline order and only once due */
+TEST(scheduler_tests, test_timer_wheel_expiry) {
+    auto start = tasks::timer_wheel::clock::now();
+    tasks::timer_wheel wheel{start, 1ms, 8};
+    wheel.schedule(1, start + 5ms);
+    wheel.schedule(2, start + 3ms);
+    wheel.schedule(3, start + 20ms);
+
+    // 20ms is more than a revolution away and shares a slot with nearer deadlines
+    EXPECT_EQ(*wheel.next_deadline(), start + 3ms);
+
+    std::vector<uint64_t> expired;
+    wheel.expire(start + 6ms, [&](uint64_t id) { expired.push_back(id); });
+    EXPECT_EQ(expired, (std::vector<uint64_t>{2, 1}));
+    EXPECT_EQ(*wheel.next_deadline(), start + 20ms);
+
+    wheel.expire(start + 19ms, [&](uint64_t id) { expired.push_back(id); });
+    EXPECT_EQ(expired.size(), 2u);
+    wheel.expire(start + 40ms, [&](uint64_t id) { expired.push_back(id); });
+    EXPECT_EQ(expired.back(), 3u);
+    EXPECT_FALSE(wheel.next_deadline());
+}
+
+/* test that cancelled timers never expire */
+TEST(scheduler_tests, test_timer_wheel_cancel) {
+    auto start = tasks::timer_wheel::clock::now();
+    tasks::timer_wheel wheel{start, 1ms, 8};
+    wheel.schedule(1, start + 2ms);
+    EXPECT_TRUE(wheel.cancel(1, start + 2ms));
+    EXPECT_FALSE(wheel.cancel(1, start + 2ms));
+    EXPECT_EQ(wheel.size(), 0u);
+
+    int expired = 0;
+    wheel.expire(start + 10ms, [&](uint64_t) { expired++; });
+    EXPECT_EQ(expired, 0);
+}
+
+/* test that the scheduler only wakes for deadlines and presents once per batch of redraws */
+TEST(scheduler_tests, test_scheduler_runs_at_deadlines) {
+    int frames = 0;
+    tasks::frame_scheduler scheduler{[&]() { frames++; }};
+    auto start = tasks::frame_scheduler::clock::now();
+
+    int fast = 0;
+    scheduler.add([&](auto) {
+        fast++;
+        return (fast < 3) ? std::optional{start + fast * 20ms} : std::nullopt;
+    }, start);
+    scheduler.add([&](auto) {
+        scheduler.stop();
+        return std::optional<tasks::frame_scheduler::time_point>{};
+    }, start + 100ms);
+
+    scheduler.run();
+    auto elapsed = tasks::frame_scheduler::clock::now() - start;
+    EXPECT_EQ(fast, 3);
+    EXPECT_EQ(frames, 4);
+    EXPECT_GE(elapsed, 100ms);
+
+    auto stats = scheduler.stats();
+    EXPECT_EQ(stats.redraws, 4u);
+    EXPECT_EQ(stats.wakeups, 4u);
+}
+
+/* test that another thread can pull a redraw forward */
+TEST(scheduler_tests, test_reschedule_wakes_loop) {
+    tasks::frame_scheduler scheduler{[]() {}};
+    auto start = tasks::frame_scheduler::clock::now();
+    auto id = scheduler.add([&](auto) {
+        scheduler.stop();
+        return std::optional<tasks::frame_scheduler::time_point>{};
+    }, start + 10s);
+
+    std::thread trigger([&]() {
+        std::this_thread::sleep_for(10ms);
+        scheduler.reschedule(id, tasks::frame_scheduler::clock::now());
+    });
+    scheduler.run();
+    trigger.join();
+    EXPECT_LT(tasks::frame_scheduler::clock::now() - start, 5s);
+}
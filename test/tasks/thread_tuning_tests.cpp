@@ -0,0 +1,75 @@
+/**
+ * \file thread_tuning_tests.cpp
+ * \brief unit tests for thread policies and the refresh jitter meter
+ * \version 0.1
+ * \date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+/********************************** Includes *******************************************/
+#include "gtest/gtest.h"
+#include "thread_tuning.hpp"
+#include <chrono>
+#include <string>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+
+/****************************** Unit Tests ***********************************/
+/* test that swaps on whole refresh periods have no jitter and swaps between them do */
+TEST(thread_tuning_tests, test_refresh_jitter) {
+    tasks::refresh_jitter jitter{100};
+    EXPECT_EQ(jitter.refresh_period(), 10ms);
+
+    auto now = tasks::refresh_jitter::clock::now();
+    jitter.record(now);
+    jitter.record(now + 10ms);
+    jitter.record(now + 30ms);
+    EXPECT_EQ(jitter.stats().samples, 2u);
+    EXPECT_EQ(jitter.stats().max, 0us);
+
+    jitter.record(now + 41ms);
+    jitter.record(now + 54ms);
+    auto stats = jitter.stats();
+    EXPECT_EQ(stats.samples, 4u);
+    EXPECT_EQ(stats.max, 3ms);
+    EXPECT_EQ(stats.mean, 1ms);
+    EXPECT_EQ(stats.late, 1u);
+
+    jitter.reset();
+    jitter.record(now + 100ms);
+    EXPECT_EQ(jitter.stats().samples, 0u);
+}
+
+/* test that the period is estimated from the shortest interval when the refresh rate is not limited */
+TEST(thread_tuning_tests, test_refresh_jitter_estimated_period) {
+    tasks::refresh_jitter jitter{0};
+    auto now = tasks::refresh_jitter::clock::now();
+    jitter.record(now);
+    jitter.record(now + 20ms);
+    jitter.record(now + 28ms);
+    jitter.record(now + 44ms);
+    EXPECT_EQ(jitter.refresh_period(), 8ms);
+    EXPECT_EQ(jitter.stats().max, 0us);
+}
+
+/* test that a policy is applied to a thread and read back */
+TEST(thread_tuning_tests, test_apply_policy) {
+    std::string errors;
+    std::string description;
+    std::thread worker{[&]() {
+        auto handle = tasks::current_thread();
+        graphics::thread_policy policy;
+        policy.cores = {0};
+        policy.nice = 5;
+        errors = tasks::apply_thread_policy(handle, policy);
+        description = tasks::describe_thread(handle);
+    }};
+    worker.join();
+    EXPECT_EQ(errors, "");
+    EXPECT_EQ(description, "cores 0 SCHED_OTHER nice 5");
+}
@@ -0,0 +1,131 @@
+/**
+ * \file work_stealing_pool_tests.cpp
+ * \brief unit tests for the work stealing pool and parallel tile rendering
+ * \version 0.1
+ * \date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+
+/********************************** Includes *******************************************/
+#include "gtest/gtest.h"
+#include "tile_renderer.hpp"
+#include "work_stealing_pool.hpp"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+
+/****************************** Unit Tests ***********************************/
+/* test that every index runs exactly once and parallel_for only returns when all are done */
+TEST(work_stealing_pool_tests, test_parallel_for_runs_every_job) {
+    tasks::work_stealing_pool pool{3};
+    std::vector<std::atomic<int>> runs(100);
+    for ( auto& run : runs ) {
+        run = 0;
+    }
+
+    pool.parallel_for(runs.size(), [&](size_t index) { runs[index]++; });
+    for ( auto& run : runs ) {
+        EXPECT_EQ(run.load(), 1);
+    }
+    EXPECT_EQ(pool.workers(), 3u);
+    EXPECT_EQ(pool.stats().jobs, 100u);
+}
+
+/* test that a pool without workers runs the batch on the calling thread */
+TEST(work_stealing_pool_tests, test_inline_pool) {
+    tasks::work_stealing_pool pool{0};
+    auto caller = std::this_thread::get_id();
+    bool same_thread = true;
+    pool.parallel_for(5, [&](size_t) { same_thread = same_thread && (std::this_thread::get_id() == caller); });
+    EXPECT_TRUE(same_thread);
+    EXPECT_EQ(pool.stats().jobs, 5u);
+}
+
+/* test that idle workers steal from a worker stuck on a slow job */
+TEST(work_stealing_pool_tests, test_slow_job_is_stolen_around) {
+    tasks::work_stealing_pool pool{2};
+    std::atomic<int> done{0};
+
+    // jobs 0 to 3 start on the first worker, which blocks on the first of them
+    pool.parallel_for(8, [&](size_t index) {
+        if ( index == 3 ) {
+            std::this_thread::sleep_for(20ms);
+        }
+        done++;
+    });
+    EXPECT_EQ(done.load(), 8);
+    EXPECT_GT(pool.stats().steals, 0u);
+}
+
+/* test that tiles cover the frame without overlapping and shapes draw identically in parallel */
+TEST(work_stealing_pool_tests, test_tile_render_matches_serial) {
+    tasks::work_stealing_pool pool{3};
+    tasks::tile_renderer renderer{pool, 5, 3};
+
+    graphics::framebuffer frame{16, 8};
+    auto tiles = renderer.split(frame);
+    EXPECT_EQ(tiles.size(), 12u);
+    int covered = 0;
+    for ( auto& tile : tiles ) {
+        covered += tile.width * tile.height;
+    }
+    EXPECT_EQ(covered, 16 * 8);
+
+    auto draw = [](graphics::canvas& canvas) {
+        for ( int y = 0; y < canvas.height(); y++ ) {
+            canvas.fill_span(y, y, 6, graphics::pixel{static_cast<uint8_t>(y * 10), 0, 255});
+        }
+        canvas.set_pixel(15, 7, graphics::pixel{1, 2, 3});
+    };
+
+    graphics::framebuffer serial{16, 8};
+    graphics::canvas serial_canvas{&serial};
+    draw(serial_canvas);
+
+    renderer.render(frame, draw);
+    for ( int y = 0; y < 8; y++ ) {
+        for ( int x = 0; x < 16; x++ ) {
+            EXPECT_EQ(frame.get_pixel(x, y), serial.get_pixel(x, y));
+        }
+    }
+}
+
+/* test that a canvas rendered in tiles keeps its own coordinates and stays inside its clip */
+TEST(work_stealing_pool_tests, test_tile_render_canvas) {
+    tasks::work_stealing_pool pool{2};
+    tasks::tile_renderer renderer{pool, 0, 2};
+
+    graphics::framebuffer frame{8, 8};
+    graphics::canvas canvas{&frame};
+    auto region = canvas.clipped(graphics::rect{0, 0, 8, 5});
+    renderer.render(region, [](graphics::canvas& tile) {
+        tile.fill_span(0, 2, 8, graphics::pixel{0, 255, 0});
+        tile.fill_span(0, 6, 8, graphics::pixel{0, 255, 0});
+    });
+    for ( int x = 0; x < 8; x++ ) {
+        EXPECT_EQ(frame.get_pixel(x, 2), graphics::pack(0, 255, 0));
+        EXPECT_EQ(frame.get_pixel(x, 6), 0u);
+    }
+}
+
+/* test that every worker runs the start hook once before taking jobs */
+TEST(work_stealing_pool_tests, test_start_hook) {
+    std::vector<std::atomic<int>> started(3);
+    for ( auto& count : started ) {
+        count = 0;
+    }
+    {
+        tasks::work_stealing_pool pool{std::vector<int>{-1, -1, -1}, [&](size_t worker) { started[worker]++; }};
+        pool.parallel_for(30, [](size_t) { std::this_thread::sleep_for(1ms); });
+    }
+    for ( auto& count : started ) {
+        EXPECT_EQ(count.load(), 1);
+    }
+}
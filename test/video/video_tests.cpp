@@ -0,0 +1,217 @@
+/**
+ * \file video_tests.cpp
+ * \brief unit tests for streaming video decode and playback
+ * \version 0.1
+ * \date 2026-10-19
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+
+/********************************** Includes *******************************************/
+#include "gtest/gtest.h"
+#include "framebuffer.hpp"
+#include "frame_ring.hpp"
+#include "video_player.hpp"
+#include "video_reader.hpp"
+#include "video_task.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/************************************ Test Fixtures ***************************************/
+// Writes test clips into a temporary directory that is removed after each test
+class video_tests : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        auto pattern = (std::filesystem::temp_directory_path() / "video_tests_XXXXXX").string();
+        ASSERT_NE(mkdtemp(pattern.data()), nullptr);
+        directory = pattern;
+    }
+
+    void TearDown() override {
+        std::error_code error;
+        std::filesystem::remove_all(directory, error);
+    }
+
+    // Get the path of a file in the test directory
+    std::string path_of(const std::string& name) const {
+        return (directory / name).string();
+    }
+
+    // Write a clip with a raw, an rle and a delta frame 100ms apart. The frames only fill a 2x2 clip.
+    std::string write_test_video(uint16_t width = 2, uint32_t duration_ms = 300) const;
+
+    std::filesystem::path directory;
+};
+
+std::string video_tests::write_test_video(uint16_t width, uint32_t duration_ms) const {
+    auto path = path_of("test_clip.video");
+    std::ofstream file{path, std::ios::binary};
+    graphics::video_header header{graphics::video_magic, graphics::video_version, 0, width, 2, 3, duration_ms, 0};
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    auto write_frame = [&](uint32_t timestamp, graphics::frame_encoding encoding, std::vector<uint32_t> payload) {
+        graphics::video_frame_header frame_header{timestamp, static_cast<uint8_t>(encoding), {0, 0, 0}, static_cast<uint32_t>(payload.size() * 4)};
+        file.write(reinterpret_cast<const char*>(&frame_header), sizeof(frame_header));
+        file.write(reinterpret_cast<const char*>(payload.data()), payload.size() * 4);
+    };
+
+    write_frame(0, graphics::frame_encoding::raw, {1, 2, 3, 4});
+    write_frame(100, graphics::frame_encoding::rle, {3, 5, 1, 6});
+    write_frame(200, graphics::frame_encoding::delta, {1, 2, 7, 8});
+    return path;
+}
+
+
+/******************************** Local Functions **************************************/
+static std::vector<uint32_t> pixels_of(const graphics::framebuffer& frame) {
+    return std::vector<uint32_t>(frame.data(), frame.data() + frame.size());
+}
+
+
+/****************************** Unit Tests ***********************************/
+/* test decoding each frame encoding and looping back to the first frame */
+TEST_F(video_tests, test_reader_decodes_and_loops) {
+    auto reader = graphics::video_reader::open(write_test_video(), 2, 2);
+    ASSERT_TRUE(reader);
+    graphics::framebuffer frame{2, 2};
+
+    ASSERT_EQ(reader.get_value().read_frame(frame).get_value(), 0u);
+    EXPECT_EQ(pixels_of(frame), (std::vector<uint32_t>{1, 2, 3, 4}));
+    ASSERT_EQ(reader.get_value().read_frame(frame).get_value(), 100u);
+    EXPECT_EQ(pixels_of(frame), (std::vector<uint32_t>{5, 5, 5, 6}));
+    ASSERT_EQ(reader.get_value().read_frame(frame).get_value(), 200u);
+    EXPECT_EQ(pixels_of(frame), (std::vector<uint32_t>{5, 7, 8, 6}));
+
+    // the second loop is offset by the clip duration
+    ASSERT_EQ(reader.get_value().read_frame(frame).get_value(), 300u);
+    EXPECT_EQ(pixels_of(frame), (std::vector<uint32_t>{1, 2, 3, 4}));
+}
+
+/* test that files with a bad header are rejected */
+TEST_F(video_tests, test_reader_rejects_invalid_file) {
+    std::ofstream{path_of("bad_clip.video"), std::ios::binary} << "not a video file at all";
+    EXPECT_FALSE(graphics::video_reader::open(path_of("bad_clip.video"), 2, 2));
+    EXPECT_FALSE(graphics::video_reader::open(path_of("missing_clip.video"), 2, 2));
+
+    // clips must match the frame they are shown on and must have a length to loop by
+    EXPECT_FALSE(graphics::video_reader::open(write_test_video(), 4, 1));
+    EXPECT_FALSE(graphics::video_reader::open(write_test_video(3), 2, 2));
+    EXPECT_FALSE(graphics::video_reader::open(write_test_video(2, 0), 2, 2));
+
+    // a frame claiming a payload larger than a raw frame is rejected before anything is allocated
+    {
+        std::ofstream file{path_of("huge_clip.video"), std::ios::binary};
+        graphics::video_header header{graphics::video_magic, graphics::video_version, 0, 2, 2, 1, 100, 0};
+        graphics::video_frame_header frame_header{0, static_cast<uint8_t>(graphics::frame_encoding::raw), {0, 0, 0}, 0xFFFFFFF0};
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(&frame_header), sizeof(frame_header));
+    }
+    auto reader = graphics::video_reader::open(path_of("huge_clip.video"), 2, 2);
+    ASSERT_TRUE(reader);
+    graphics::framebuffer frame{2, 2};
+    EXPECT_FALSE(reader.get_value().read_frame(frame));
+}
+
+/* test that the ring blocks the producer at capacity and hands frames out in order */
+TEST_F(video_tests, test_frame_ring_order_and_capacity) {
+    graphics::frame_ring ring{2, 1, 1};
+    EXPECT_EQ(ring.peek(), nullptr);
+
+    for ( uint64_t i = 0; i < 2; i++ ) {
+        auto slot = ring.acquire();
+        ASSERT_NE(slot, nullptr);
+        slot->timestamp_ms = i;
+        ring.commit();
+    }
+    EXPECT_EQ(ring.size(), 2u);
+    EXPECT_EQ(ring.peek(1)->timestamp_ms, 1u);
+
+    // a full ring releases a waiting producer when closed
+    std::thread producer([&]() { EXPECT_EQ(ring.acquire(), nullptr); });
+    ring.close();
+    producer.join();
+
+    EXPECT_EQ(ring.peek()->timestamp_ms, 0u);
+    ring.pop();
+    EXPECT_EQ(ring.peek()->timestamp_ms, 1u);
+}
+
+/* test that the player presents the newest due frame and drops the ones it skipped */
+TEST_F(video_tests, test_player_paces_to_timestamps) {
+    auto reader = graphics::video_reader::open(write_test_video(), 2, 2);
+    ASSERT_TRUE(reader);
+    graphics::video_player player{std::move(reader.get_value()), 4};
+    graphics::framebuffer frame{2, 2};
+
+    player.start();
+    while ( player.statistics().decoded < 4 ) {
+        std::this_thread::yield();
+    }
+    auto start = *player.next_deadline();
+
+    EXPECT_TRUE(player.update(frame, start));
+    EXPECT_EQ(pixels_of(frame), (std::vector<uint32_t>{1, 2, 3, 4}));
+    EXPECT_FALSE(player.update(frame, start + std::chrono::milliseconds(50)));
+    EXPECT_EQ(player.statistics().underruns, 0u);
+
+    // 250ms in, the 100ms frame is late and only the 200ms frame is shown
+    EXPECT_TRUE(player.update(frame, start + std::chrono::milliseconds(250)));
+    EXPECT_EQ(pixels_of(frame), (std::vector<uint32_t>{5, 7, 8, 6}));
+    player.stop();
+
+    auto statistics = player.statistics();
+    EXPECT_EQ(statistics.presented, 2u);
+    EXPECT_EQ(statistics.dropped, 1u);
+}
+
+/* test that an empty ring counts one underrun per frame interval that passes, not one per poll */
+TEST_F(video_tests, test_player_counts_underruns_per_frame) {
+    auto reader = graphics::video_reader::open(write_test_video(), 2, 2);
+    ASSERT_TRUE(reader);
+    graphics::video_player player{std::move(reader.get_value()), 4};
+    graphics::framebuffer frame{2, 2};
+
+    player.start();
+    while ( player.statistics().decoded < 4 ) {
+        std::this_thread::yield();
+    }
+    auto start = *player.next_deadline();
+    player.stop();
+
+    // with decoding stopped, the ring drains and every later frame interval is an underrun
+    auto late = start + std::chrono::seconds(1000);
+    EXPECT_TRUE(player.update(frame, late));
+    EXPECT_FALSE(player.update(frame, late));
+    EXPECT_FALSE(player.update(frame, late));
+    EXPECT_EQ(player.statistics().underruns, 1u);
+    EXPECT_FALSE(player.update(frame, late + std::chrono::milliseconds(50)));
+    EXPECT_EQ(player.statistics().underruns, 1u);
+    EXPECT_FALSE(player.update(frame, late + std::chrono::milliseconds(100)));
+    EXPECT_EQ(player.statistics().underruns, 2u);
+}
+
+/* test that the video task draws the due frame and asks to be drawn again at the next timestamp */
+TEST_F(video_tests, test_task_paces_to_timestamps) {
+    auto reader = graphics::video_reader::open(write_test_video(), 2, 2);
+    ASSERT_TRUE(reader);
+    tasks::video_task task{std::move(reader.get_value())};
+    graphics::framebuffer frame{2, 2};
+    graphics::canvas canvas{&frame};
+
+    while ( task.statistics().decoded < 3 ) {
+        std::this_thread::yield();
+    }
+    auto now = tasks::video_task::clock::now();
+    auto next = task.draw(canvas, now + std::chrono::milliseconds(20));
+    ASSERT_TRUE(next);
+    EXPECT_EQ(pixels_of(frame), (std::vector<uint32_t>{1, 2, 3, 4}));
+    EXPECT_GT(*next, now + std::chrono::milliseconds(80));
+    EXPECT_LE(*next, now + std::chrono::milliseconds(100));
+}